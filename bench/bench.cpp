@@ -0,0 +1,216 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : bench
+// @created     : Monday Oct 26, 2026 09:05:33 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <new>
+#include <cmath>
+#include <atomic>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+#include <electra/random.hpp>
+
+namespace bench
+{
+
+// Data types
+using Cell = std::pair<int32_t,int32_t>;
+using Wire = std::vector<Cell>;
+
+//
+// Allocations of the whole process, counted by the global
+// operator new below
+//
+inline std::atomic<std::uint64_t> allocations {0};
+inline std::atomic<std::uint64_t> bytes {0};
+
+//
+// Counts the allocations between its construction and report,
+// which sets the per operation and per element counters
+//
+class Allocations
+{
+  private:
+  // Private Members
+    std::uint64_t allocations_start;
+    std::uint64_t bytes_start;
+  public:
+  // Constructors
+    Allocations() noexcept
+      : allocations_start(allocations.load())
+      , bytes_start(bytes.load())
+    {
+    }
+  // Public Methods
+    void report(benchmark::State& state, double operations, double elements) const
+    {
+      auto n { static_cast<double>(allocations.load() - this->allocations_start) };
+      auto b { static_cast<double>(bytes.load() - this->bytes_start) };
+      state.counters["allocs/op"] = n / std::max(operations, 1.0);
+      state.counters["bytes/element"] = b / std::max(elements, 1.0);
+    }
+};
+
+//
+// Time per operation, in seconds, for benchmarks whose
+// iterations run many of them
+//
+inline void operations(benchmark::State& state, double per_iteration)
+{
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * per_iteration));
+  state.counters["time/op"] = benchmark::Counter(per_iteration,
+    benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+
+//
+// Sizes from 10^2 up to 10^7 elements, containers with linear
+// lookups stop at 10^5
+//
+inline void sizes(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(10)->Range(100, 10'000'000);
+}
+
+inline void linear_sizes(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(10)->Range(100, 100'000);
+}
+
+//
+// Sizes of the sparse grid structures, the second argument is
+// the spacing of the cells; 10^6 cells 100 apart span a
+// 10^5 x 10^5 grid
+//
+inline void spread_sizes(benchmark::internal::Benchmark* b)
+{
+  b->ArgsProduct({{10'000, 1'000'000}, {1, 100}});
+}
+
+//
+// N distinct cells of a square grid, spread apart from each
+// other and shuffled with a fixed seed
+//
+inline std::vector<Cell> cells(std::size_t n, std::uint64_t seed = 0, int32_t spread = 1)
+{
+  auto side { static_cast<int32_t>(std::ceil(std::sqrt(static_cast<double>(n)))) };
+
+  std::vector<Cell> cells;
+  cells.reserve(n);
+  for( std::size_t k{0}; k < n; ++k )
+  {
+    cells.emplace_back(static_cast<int32_t>(k) % side * spread,
+      static_cast<int32_t>(k) / side * spread);
+  }
+
+  electra::random::Generator generator(seed);
+  for( std::size_t k{n}; k > 1; --k )
+  {
+    std::swap(cells[k-1], cells[generator.below(k)]);
+  }
+
+  return cells;
+}
+
+//
+// N disjoint wires of seven cells with a single bend, each in
+// its own 8x8 tile of a square grid
+//
+inline std::vector<Wire> wires(std::size_t n)
+{
+  auto side { static_cast<int32_t>(std::ceil(std::sqrt(static_cast<double>(n)))) };
+
+  std::vector<Wire> wires;
+  wires.reserve(n);
+  for( std::size_t k{0}; k < n; ++k )
+  {
+    int32_t x { (static_cast<int32_t>(k) % side) * 8 };
+    int32_t y { (static_cast<int32_t>(k) / side) * 8 };
+    wires.push_back({{x,y},{x+1,y},{x+2,y},{x+3,y},{x+3,y+1},{x+3,y+2},{x+3,y+3}});
+  }
+
+  return wires;
+}
+
+} // namespace bench
+
+//
+// Counting allocator, replaces the global operator new; the
+// aligned versions are the ones used by memory resources
+//
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size)
+{
+  bench::allocations.fetch_add(1, std::memory_order_relaxed);
+  bench::bytes.fetch_add(size, std::memory_order_relaxed);
+  if( auto p {std::malloc(size ? size : 1)} ) return p;
+  throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+  bench::allocations.fetch_add(1, std::memory_order_relaxed);
+  bench::bytes.fetch_add(size, std::memory_order_relaxed);
+  auto a { std::max(static_cast<std::size_t>(alignment), sizeof(void*)) };
+  if( auto p {std::aligned_alloc(a, (std::max<std::size_t>(size, 1) + a - 1) / a * a)} ) return p;
+  throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) { return ::operator new(size); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return ::operator new(size, alignment); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+#include "include/electra/area.cpp"
+#include "include/electra/occupancy.cpp"
+#include "include/electra/placements.cpp"
+#include "include/electra/wires.cpp"
+#include "include/electra/wire/encode.cpp"
+
+int main(int argc, char** argv)
+{
+  //
+  // Results are written as json unless an output is given,
+  // so runs can be compared between releases
+  //
+  std::vector<char*> args(argv, argv + argc);
+  bool out { std::any_of(args.cbegin(), args.cend(), [](char const* arg)
+    { return std::string{arg}.rfind("--benchmark_out=", 0) == 0; }) };
+
+  static char json_out[] { "--benchmark_out=electra_bench.json" };
+  static char json_format[] { "--benchmark_out_format=json" };
+  if( ! out )
+  {
+    args.push_back(json_out);
+    args.push_back(json_format);
+  }
+
+  int count { static_cast<int>(args.size()) };
+  benchmark::Initialize(&count, args.data());
+  if( benchmark::ReportUnrecognizedArguments(count, args.data()) ) return 1;
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  return 0;
+}
@@ -0,0 +1,92 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : area
+// @created     : Monday Oct 26, 2026 09:41:18 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <electra/area.hpp>
+
+static void area_insert(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto cells { bench::cells(n) };
+
+  bench::Allocations allocations;
+  for( auto _ : state )
+  {
+    electra::area::Area<int32_t> area;
+    area.insert(cells);
+    benchmark::DoNotOptimize(area.get_area());
+  }
+
+  bench::operations(state, static_cast<double>(n));
+  allocations.report(state, static_cast<double>(state.iterations() * n),
+    static_cast<double>(state.iterations() * n));
+}
+BENCHMARK(area_insert)->Apply(bench::sizes);
+
+static void area_insert_batch(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto cells { bench::cells(n) };
+
+  bench::Allocations allocations;
+  for( auto _ : state )
+  {
+    electra::area::Area<int32_t> area;
+    area.insert(cells.cbegin(), cells.cend());
+    benchmark::DoNotOptimize(area.get_area());
+  }
+
+  bench::operations(state, static_cast<double>(n));
+  allocations.report(state, static_cast<double>(state.iterations() * n),
+    static_cast<double>(state.iterations() * n));
+}
+BENCHMARK(area_insert_batch)->Apply(bench::sizes);
+
+static void area_erase(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto cells { bench::cells(n) };
+
+  for( auto _ : state )
+  {
+    state.PauseTiming();
+    electra::area::Area<int32_t> area;
+    area.insert(cells);
+    state.ResumeTiming();
+
+    area.erase(cells);
+    benchmark::DoNotOptimize(area.get_area());
+  }
+
+  bench::operations(state, static_cast<double>(n));
+}
+BENCHMARK(area_erase)->Apply(bench::sizes);
+
+//
+// Bytes per cell held by the area, which only keeps the rows
+// and columns in use; see occupancy_memory_usage
+//
+static void area_memory_usage(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto cells { bench::cells(n, 0, static_cast<int32_t>(state.range(1))) };
+
+  electra::area::Area<int32_t> area;
+  area.insert(cells);
+
+  electra::memory::Usage usage;
+  for( auto _ : state )
+  {
+    usage = area.memory_usage();
+    benchmark::DoNotOptimize(usage);
+  }
+
+  state.counters["bytes/cell"] = static_cast<double>(usage.total()) / static_cast<double>(n);
+}
+BENCHMARK(area_memory_usage)->Apply(bench::spread_sizes);
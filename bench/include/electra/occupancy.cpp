@@ -0,0 +1,79 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : occupancy
+// @created     : Monday Oct 19, 2026 18:02:37 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <electra/occupancy.hpp>
+
+static void occupancy_insert(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto cells { bench::cells(n, 0, static_cast<int32_t>(state.range(1))) };
+
+  bench::Allocations allocations;
+  for( auto _ : state )
+  {
+    electra::occupancy::Occupancy<int32_t> occupancy;
+    occupancy.insert(cells);
+    benchmark::DoNotOptimize(occupancy.size());
+  }
+
+  bench::operations(state, static_cast<double>(n));
+  allocations.report(state, static_cast<double>(state.iterations() * n),
+    static_cast<double>(state.iterations() * n));
+}
+BENCHMARK(occupancy_insert)->Apply(bench::spread_sizes);
+
+//
+// Membership of the cells in a random order, half of them
+// shifted off the grid; compare with placements_at, the map
+// keyed by cell
+//
+static void occupancy_contains(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto spread { static_cast<int32_t>(state.range(1)) };
+  auto cells { bench::cells(n, 0, spread) };
+  auto probes { bench::cells(n, 1, spread) };
+  for( std::size_t k{0}; k < n; k += 2 ) probes[k].first = -1 - probes[k].first;
+
+  electra::occupancy::Occupancy<int32_t> occupancy;
+  occupancy.insert(cells);
+
+  std::size_t k {0};
+  for( auto _ : state )
+  {
+    benchmark::DoNotOptimize(occupancy.contains(probes[k]));
+    if( ++k == n ) k = 0;
+  }
+}
+BENCHMARK(occupancy_contains)->Apply(bench::spread_sizes);
+
+//
+// Bytes per cell held by the occupancy, see area_memory_usage
+// for the same cells
+//
+static void occupancy_memory_usage(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto cells { bench::cells(n, 0, static_cast<int32_t>(state.range(1))) };
+
+  electra::occupancy::Occupancy<int32_t> occupancy;
+  occupancy.insert(cells);
+  occupancy.shrink_to_fit();
+
+  electra::memory::Usage usage;
+  for( auto _ : state )
+  {
+    usage = occupancy.memory_usage();
+    benchmark::DoNotOptimize(usage);
+  }
+
+  state.counters["bytes/cell"] = static_cast<double>(usage.total()) / static_cast<double>(n);
+}
+BENCHMARK(occupancy_memory_usage)->Apply(bench::spread_sizes);
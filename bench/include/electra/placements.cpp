@@ -0,0 +1,181 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : placements
+// @created     : Monday Oct 26, 2026 09:52:04 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <electra/placements.hpp>
+
+static void placements_insert(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto cells { bench::cells(n) };
+
+  bench::Allocations allocations;
+  for( auto _ : state )
+  {
+    electra::placement::Placements<int32_t> placements;
+    for( std::size_t k{0}; k < n; ++k )
+    {
+      placements.insert( {cells[k], static_cast<int32_t>(k)} );
+    }
+    benchmark::DoNotOptimize(placements.size());
+  }
+
+  bench::operations(state, static_cast<double>(n));
+  allocations.report(state, static_cast<double>(state.iterations() * n),
+    static_cast<double>(state.iterations() * n));
+}
+BENCHMARK(placements_insert)->Apply(bench::sizes);
+
+static void placements_insert_batch(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto cells { bench::cells(n) };
+
+  std::vector<std::pair<bench::Cell,int32_t>> entries;
+  for( std::size_t k{0}; k < n; ++k ) entries.emplace_back(cells[k], static_cast<int32_t>(k));
+
+  bench::Allocations allocations;
+  for( auto _ : state )
+  {
+    electra::placement::Placements<int32_t> placements;
+    placements.insert(entries.cbegin(), entries.cend());
+    benchmark::DoNotOptimize(placements.size());
+  }
+
+  bench::operations(state, static_cast<double>(n));
+  allocations.report(state, static_cast<double>(state.iterations() * n),
+    static_cast<double>(state.iterations() * n));
+}
+BENCHMARK(placements_insert_batch)->Apply(bench::sizes);
+
+static void placements_at(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto cells { bench::cells(n) };
+  auto probes { bench::cells(n, 1) };
+
+  electra::placement::Placements<int32_t> placements;
+  for( std::size_t k{0}; k < n; ++k )
+  {
+    placements.insert( {cells[k], static_cast<int32_t>(k)} );
+  }
+
+  std::size_t k {0};
+  bench::Allocations allocations;
+  for( auto _ : state )
+  {
+    benchmark::DoNotOptimize(placements.at(probes[k]));
+    if( ++k == n ) k = 0;
+  }
+
+  allocations.report(state, static_cast<double>(state.iterations()),
+    static_cast<double>(n));
+}
+BENCHMARK(placements_at)->Apply(bench::sizes);
+
+//
+// Lookups of a router expansion step, the cells of a window
+// at a random corner, answered at once or with a loop of at()
+//
+static void placements_at_batch(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto batch { static_cast<bool>(state.range(1)) };
+  auto cells { bench::cells(n) };
+  auto probes { bench::cells(n, 1) };
+
+  electra::placement::Placements<int32_t> placements;
+  for( std::size_t k{0}; k < n; ++k )
+  {
+    placements.insert( {cells[k], static_cast<int32_t>(k)} );
+  }
+
+  std::size_t const width {32};
+  std::vector<bench::Cell> queries;
+  std::vector<std::optional<int32_t>> ids(width * width);
+  std::size_t k {0};
+  for( auto _ : state )
+  {
+    state.PauseTiming();
+    queries.clear();
+    auto const& probe { probes[k] };
+    for( std::size_t i{0}; i < width * width; ++i )
+    {
+      queries.emplace_back(probe.first + static_cast<int32_t>(i % width),
+        probe.second + static_cast<int32_t>(i / width));
+    }
+    if( ++k == n ) k = 0;
+    state.ResumeTiming();
+
+    if( batch )
+    {
+      placements.at(queries.cbegin(), queries.cend(), ids.begin());
+    }
+    else
+    {
+      for( std::size_t i{0}; i < queries.size(); ++i ) ids[i] = placements.at(queries[i]);
+    }
+    benchmark::DoNotOptimize(ids.data());
+  }
+
+  bench::operations(state, static_cast<double>(width * width));
+}
+BENCHMARK(placements_at_batch)->ArgsProduct({{10'000, 1'000'000}, {0, 1}});
+
+static void placements_erase(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto cells { bench::cells(n) };
+
+  for( auto _ : state )
+  {
+    state.PauseTiming();
+    electra::placement::Placements<int32_t> placements;
+    for( std::size_t k{0}; k < n; ++k )
+    {
+      placements.insert( {cells[k], static_cast<int32_t>(k)} );
+    }
+    state.ResumeTiming();
+
+    for( std::size_t k{0}; k < n; ++k )
+    {
+      placements.erase(static_cast<int32_t>(k));
+    }
+    benchmark::DoNotOptimize(placements.size());
+  }
+
+  bench::operations(state, static_cast<double>(n));
+}
+BENCHMARK(placements_erase)->Apply(bench::sizes);
+
+static void placements_erase_batch(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto cells { bench::cells(n) };
+
+  std::vector<int32_t> ids;
+  for( std::size_t k{0}; k < n; ++k ) ids.push_back(static_cast<int32_t>(k));
+
+  for( auto _ : state )
+  {
+    state.PauseTiming();
+    electra::placement::Placements<int32_t> placements;
+    for( std::size_t k{0}; k < n; ++k )
+    {
+      placements.insert( {cells[k], static_cast<int32_t>(k)} );
+    }
+    state.ResumeTiming();
+
+    placements.erase(ids.cbegin(), ids.cend());
+    benchmark::DoNotOptimize(placements.size());
+  }
+
+  bench::operations(state, static_cast<double>(n));
+}
+BENCHMARK(placements_erase_batch)->Apply(bench::sizes);
@@ -0,0 +1,68 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : encode
+// @created     : Monday Oct 26, 2026 10:36:22 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <electra/wire/encode.hpp>
+#include <electra/wire/decode.hpp>
+
+//
+// A single staircase wire of N cells, one bend every four
+//
+static bench::Wire staircase(std::size_t n)
+{
+  bench::Wire wire;
+  wire.reserve(n);
+
+  bench::Cell cell {0,0};
+  for( std::size_t k{0}; k < n; ++k )
+  {
+    wire.push_back(cell);
+    if( (k / 4) % 2 == 0 ) ++cell.first;
+    else ++cell.second;
+  }
+
+  return wire;
+}
+
+static void wire_encode(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto wire { staircase(n) };
+
+  bench::Allocations allocations;
+  for( auto _ : state )
+  {
+    auto encoded { electra::wire::encode(wire.cbegin(), wire.cend()) };
+    benchmark::DoNotOptimize(encoded.data());
+  }
+
+  bench::operations(state, static_cast<double>(n));
+  allocations.report(state, static_cast<double>(state.iterations()),
+    static_cast<double>(state.iterations() * n));
+}
+BENCHMARK(wire_encode)->Apply(bench::sizes);
+
+static void wire_decode(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto wire { staircase(n) };
+  auto encoded { electra::wire::encode(wire.cbegin(), wire.cend()) };
+
+  bench::Allocations allocations;
+  for( auto _ : state )
+  {
+    auto decoded { electra::wire::decode(encoded.cbegin(), encoded.cend()) };
+    benchmark::DoNotOptimize(decoded.data());
+  }
+
+  bench::operations(state, static_cast<double>(n));
+  allocations.report(state, static_cast<double>(state.iterations()),
+    static_cast<double>(state.iterations() * n));
+}
+BENCHMARK(wire_decode)->Apply(bench::sizes);
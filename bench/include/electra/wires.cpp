@@ -0,0 +1,181 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : wires
+// @created     : Monday Oct 26, 2026 10:13:47 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <electra/wires.hpp>
+
+static void wires_insert(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto wires { bench::wires(n) };
+
+  bench::Allocations allocations;
+  for( auto _ : state )
+  {
+    electra::wire::Wires<int32_t> container;
+    for( auto const& wire : wires ) container.insert(wire);
+    benchmark::DoNotOptimize(container.size());
+  }
+
+  bench::operations(state, static_cast<double>(n));
+  allocations.report(state, static_cast<double>(state.iterations() * n),
+    static_cast<double>(state.iterations() * n * wires.front().size()));
+}
+BENCHMARK(wires_insert)->Apply(bench::sizes);
+
+static void wires_insert_batch(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  electra::executor::Pool pool(static_cast<std::size_t>(state.range(1)));
+  auto wires { bench::wires(n) };
+
+  bench::Allocations allocations;
+  for( auto _ : state )
+  {
+    electra::wire::Wires<int32_t> container;
+    container.insert(wires.cbegin(), wires.cend(), &pool);
+    benchmark::DoNotOptimize(container.size());
+  }
+
+  bench::operations(state, static_cast<double>(n));
+  allocations.report(state, static_cast<double>(state.iterations() * n),
+    static_cast<double>(state.iterations() * n * wires.front().size()));
+}
+BENCHMARK(wires_insert_batch)->ArgsProduct({{100, 10'000, 1'000'000}, {1, 4}});
+
+static void wires_enable_occupancy(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  electra::executor::Pool pool(static_cast<std::size_t>(state.range(1)));
+  auto wires { bench::wires(n) };
+
+  electra::wire::Wires<int32_t> container;
+  container.insert(wires.cbegin(), wires.cend());
+  for( auto _ : state )
+  {
+    container.enable_occupancy(&pool);
+    benchmark::DoNotOptimize(container.get_occupancy());
+  }
+
+  bench::operations(state, static_cast<double>(n));
+}
+BENCHMARK(wires_enable_occupancy)->ArgsProduct({{100, 10'000, 1'000'000}, {1, 4}});
+
+static void wires_find(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto wires { bench::wires(n) };
+
+  electra::wire::Wires<int32_t> container;
+  for( auto const& wire : wires ) container.insert(wire);
+
+  electra::random::Generator generator;
+  for( auto _ : state )
+  {
+    auto const& wire { wires[generator.below(n)] };
+    benchmark::DoNotOptimize(container.find(wire.front(), wire.back()));
+  }
+}
+BENCHMARK(wires_find)->Apply(bench::linear_sizes);
+
+static void wires_erase(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto wires { bench::wires(n) };
+
+  for( auto _ : state )
+  {
+    state.PauseTiming();
+    electra::wire::Wires<int32_t> container;
+    for( auto const& wire : wires ) container.insert(wire);
+    state.ResumeTiming();
+
+    // Erased from the back, each lookup scans the whole storage
+    for( auto it{wires.crbegin()}; it != wires.crend(); ++it )
+    {
+      container.erase(it->front(), it->back());
+    }
+    benchmark::DoNotOptimize(container.size());
+  }
+
+  bench::operations(state, static_cast<double>(n));
+}
+BENCHMARK(wires_erase)->Apply(bench::linear_sizes);
+
+static void wires_erase_handle(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto wires { bench::wires(n) };
+
+  std::vector<electra::wire::Handle> handles;
+  for( auto _ : state )
+  {
+    state.PauseTiming();
+    electra::wire::Wires<int32_t> container;
+    handles.clear();
+    for( auto const& wire : wires ) handles.push_back(container.insert(wire));
+    state.ResumeTiming();
+
+    // Erased from the front, the last wire fills each hole
+    for( auto const& handle : handles ) container.erase(handle);
+    benchmark::DoNotOptimize(container.size());
+  }
+
+  bench::operations(state, static_cast<double>(n));
+}
+BENCHMARK(wires_erase_handle)->Apply(bench::sizes);
+
+static void wires_erase_batch(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto wires { bench::wires(n) };
+
+  std::vector<std::pair<bench::Cell,bench::Cell>> endpoints;
+  for( auto const& wire : wires ) endpoints.emplace_back(wire.front(), wire.back());
+
+  for( auto _ : state )
+  {
+    state.PauseTiming();
+    electra::wire::Wires<int32_t> container;
+    for( auto const& wire : wires ) container.insert(wire);
+    state.ResumeTiming();
+
+    // A single scan of the storage
+    container.erase(endpoints.crbegin(), endpoints.crend());
+    benchmark::DoNotOptimize(container.size());
+  }
+
+  bench::operations(state, static_cast<double>(n));
+}
+BENCHMARK(wires_erase_batch)->Apply(bench::sizes);
+
+static void wires_iterate(benchmark::State& state)
+{
+  auto n { static_cast<std::size_t>(state.range(0)) };
+  auto wires { bench::wires(n) };
+
+  electra::wire::Wires<int32_t> container;
+  for( auto const& wire : wires ) container.insert(wire);
+
+  bench::Allocations allocations;
+  for( auto _ : state )
+  {
+    std::size_t cells {0};
+    for( auto it{container.cbegin()}; it != container.cend(); ++it )
+    {
+      cells += it->size();
+    }
+    benchmark::DoNotOptimize(cells);
+  }
+
+  bench::operations(state, static_cast<double>(n));
+  allocations.report(state, static_cast<double>(state.iterations() * n),
+    static_cast<double>(n * wires.front().size()));
+}
+BENCHMARK(wires_iterate)->Apply(bench::sizes);
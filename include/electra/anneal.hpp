@@ -0,0 +1,556 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : anneal
+// @created     : Wednesday Oct 21, 2026 10:02:31 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cmath>
+#include <chrono>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <algorithm>
+#include <type_traits>
+
+#include <electra/executor.hpp>
+#include <electra/placements.hpp>
+#include <electra/random.hpp>
+
+namespace electra::anneal
+{
+
+// Data types
+template<typename T>
+using Net = std::vector<T>;
+template<typename T>
+using Netlist = std::vector<Net<T>>;
+
+struct Options
+{
+  // Base seed, runs with the same seed and options are equal
+  std::uint64_t seed {0};
+  // Each sweep tries one move per placement
+  std::size_t sweeps {100};
+  // Starting temperature of the coldest replica, when zero it
+  // is the average wirelength of a net
+  double initial_temperature {0};
+  // Temperatures are multiplied by it after each sweep
+  double cooling {0.95};
+  // Weight of the area of the placements in the cost
+  double area_weight {0};
+  // Parallel tempering replicas, each one hotter than the
+  // previous by temperature_ratio
+  std::size_t replicas {1};
+  double temperature_ratio {2};
+  // The region is split in this many stripes, each one annealed
+  // as a task of the executor during a sweep
+  std::size_t threads {1};
+  // Largest distance of a move, zero means the whole region
+  std::size_t range {0};
+};
+
+struct Report
+{
+  double cost {0};
+  std::uint64_t wirelength {0};
+  std::uint64_t area {0};
+  std::uint64_t moves {0};
+  std::uint64_t accepted {0};
+  std::uint64_t exchanges {0};
+  double seconds {0};
+  double moves_per_second {0};
+};
+
+//
+// Algorithm's Description:
+//   Simulated annealing of the placements inside a region. A
+//   move takes a placement to a random cell around it, swapping
+//   it with the one found there, and is kept when it lowers the
+//   cost, or else with a probability that falls with the
+//   temperature. The cost is the half perimeter wirelength of
+//   the nets plus the weighted area of the placements.
+//
+//   During a sweep the region is split in vertical stripes and
+//   each one is annealed as a task of the executor, on a copy
+//   of its placements. Placements of the other stripes are
+//   frozen at their position at the start of the sweep; stripe
+//   boundaries shift on every other sweep so placements can
+//   cross them.
+//
+//   Replicas at increasing temperatures run side by side, and
+//   after each sweep neighbouring replicas exchange their
+//   placements following the parallel tempering criterion.
+//
+// Cavefeats:
+//   Placements are expected to be legal, as a placement sharing
+//   its cell with another one is moved with the one owning it.
+//
+template<typename T>
+class Annealer
+{
+  private:
+  // Private Types
+    using Cell = std::pair<T,T>;
+    using Bounds = std::pair<Cell,Cell>;
+    struct Replica
+    {
+      placement::Placements<T> placements;
+      std::vector<Cell> cells;
+      double cost;
+    };
+    struct Stripe
+    {
+      T x0;
+      T x1;
+      std::vector<std::size_t> members;
+      std::optional<Bounds> frozen;
+      std::vector<std::pair<std::size_t,Cell>> moved;
+      std::uint64_t moves;
+      std::uint64_t accepted;
+    };
+  // Private Members
+    Cell a;
+    Cell b;
+    Options options;
+    std::vector<T> ids;
+    std::vector<std::vector<std::size_t>> nets;
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> incidence;
+    std::vector<Replica> replicas;
+    std::vector<double> temperatures;
+  public:
+  // Constructors
+    Annealer(placement::Placements<T> const& placements, Netlist<T> const& netlist,
+      Cell const& a, Cell const& b, Options const& options) noexcept;
+  // Public Methods
+    // Operations
+    Report run(placement::Placements<T>& placements,
+      executor::Executor* executor = executor::get_default()) noexcept;
+  private:
+  // Private Methods
+    // Lookup
+    std::uint64_t wirelength(std::vector<Cell> const& cells) const noexcept;
+    std::uint64_t wirelength(std::vector<Cell> const& cells, std::size_t net) const noexcept;
+    double cost(Replica const& replica) const noexcept;
+    // Operations
+    void sweep(Replica const& replica, Stripe& stripe, double temperature,
+      std::uint64_t seed) const noexcept;
+    void exchange(std::size_t sweep, Report& report) noexcept;
+  public:
+  // Static Assertions
+    static_assert(std::is_integral<T>::value, "T must be of an integral type");
+    static_assert(std::is_signed<T>::value, "T must be of a signed type");
+};
+
+//
+// Constructors
+//
+template<typename T>
+Annealer<T>::Annealer(placement::Placements<T> const& placements,
+  Netlist<T> const& netlist, Cell const& a, Cell const& b,
+  Options const& options) noexcept
+  : a({std::min(a.first, b.first), std::min(a.second, b.second)})
+  , b({std::max(a.first, b.first), std::max(a.second, b.second)})
+  , options(options)
+{
+  //
+  // Placements are annealed by their index in the sorted ids,
+  // which also is their id in the copies kept by the replicas
+  //
+  std::vector<Cell> cells;
+  for( auto it{placements.id_cbegin()}; it != placements.id_cend(); ++it )
+  {
+    this->ids.push_back(it->first);
+    cells.push_back(it->second);
+  }
+
+  for( auto const& net : netlist )
+  {
+    std::vector<std::size_t> pins;
+    for( auto id : net )
+    {
+      auto search { std::lower_bound(this->ids.cbegin(), this->ids.cend(), id) };
+      if( search != this->ids.cend() && *search == id )
+      {
+        pins.push_back(static_cast<std::size_t>(search - this->ids.cbegin()));
+      }
+    }
+    std::sort(pins.begin(), pins.end());
+    pins.erase(std::unique(pins.begin(), pins.end()), pins.end());
+    if( pins.size() > 1 ) this->nets.push_back(std::move(pins));
+  }
+
+  //
+  // Nets of each placement, in compressed rows
+  //
+  this->offsets.assign(this->ids.size() + 1, 0);
+  for( auto const& net : this->nets ) for( auto pin : net ) ++this->offsets[pin+1];
+  std::partial_sum(this->offsets.cbegin(), this->offsets.cend(), this->offsets.begin());
+
+  this->incidence.resize(this->offsets.back());
+  auto fill { this->offsets };
+  for( std::size_t n{0}; n < this->nets.size(); ++n )
+  {
+    for( auto pin : this->nets[n] ) this->incidence[fill[pin]++] = n;
+  }
+
+  auto replicas { std::max<std::size_t>(this->options.replicas, 1) };
+  for( std::size_t r{0}; r < replicas; ++r )
+  {
+    Replica replica { placement::Placements<T>{}, cells, 0 };
+    for( std::size_t i{0}; i < cells.size(); ++i )
+    {
+      replica.placements.insert({cells[i], static_cast<T>(i)});
+    }
+    replica.cost = this->cost(replica);
+    this->replicas.push_back(std::move(replica));
+  }
+
+  auto temperature { this->options.initial_temperature };
+  if( temperature <= 0 )
+  {
+    temperature = this->nets.empty() ? 1.0
+      : static_cast<double>(this->wirelength(cells)) / this->nets.size();
+    temperature = std::max(temperature, 1.0);
+  }
+
+  for( std::size_t r{0}; r < replicas; ++r )
+  {
+    this->temperatures.push_back(temperature);
+    temperature *= this->options.temperature_ratio;
+  }
+}
+
+//
+// Public Methods
+//
+template<typename T>
+Report Annealer<T>::run(placement::Placements<T>& placements,
+  executor::Executor* executor) noexcept
+{
+  Report report;
+
+  auto start { std::chrono::steady_clock::now() };
+
+  auto width { static_cast<std::size_t>(this->b.first - this->a.first) + 1 };
+  auto count { std::clamp<std::size_t>(this->options.threads, 1, width) };
+
+  auto best { this->replicas.front().cells };
+  auto best_cost { this->replicas.front().cost };
+
+  for( std::size_t s{0}; s < this->options.sweeps; ++s )
+  {
+    //
+    // Stripe boundaries, shifted by half a stripe on odd sweeps
+    //
+    std::vector<T> bounds { this->a.first };
+    auto shift { (s % 2) ? width / (2*count) : 0 };
+    for( std::size_t k{1}; k < count; ++k )
+    {
+      bounds.push_back(static_cast<T>(this->a.first
+        + static_cast<T>(std::min(k*width/count + shift, width))));
+    }
+    bounds.push_back(static_cast<T>(this->b.first + 1));
+
+    std::vector<std::vector<Stripe>> stripes(this->replicas.size());
+
+    for( std::size_t r{0}; r < this->replicas.size(); ++r )
+    {
+      auto& replica { this->replicas[r] };
+      auto& current { stripes[r] };
+
+      for( std::size_t k{0}; k < count; ++k )
+      {
+        current.push_back({bounds[k], static_cast<T>(bounds[k+1] - 1), {}, std::nullopt, {}, 0, 0});
+      }
+
+      std::vector<std::optional<Bounds>> boxes(count);
+      for( std::size_t i{0}; i < replica.cells.size(); ++i )
+      {
+        auto const& cell { replica.cells[i] };
+        auto x { std::clamp(cell.first, this->a.first, this->b.first) };
+        auto k { static_cast<std::size_t>(std::upper_bound(bounds.cbegin(),
+          bounds.cend(), x) - bounds.cbegin()) - 1 };
+        current[k].members.push_back(i);
+
+        auto& box { boxes[k] };
+        if( ! box ) box = Bounds{cell, cell};
+        box->first = {std::min(box->first.first, cell.first), std::min(box->first.second, cell.second)};
+        box->second = {std::max(box->second.first, cell.first), std::max(box->second.second, cell.second)};
+      }
+
+      for( std::size_t k{0}; k < count; ++k )
+      {
+        for( std::size_t l{0}; l < count; ++l )
+        {
+          if( l == k || ! boxes[l] ) continue;
+          auto& frozen { current[k].frozen };
+          if( ! frozen ) { frozen = boxes[l]; continue; }
+          frozen->first = {std::min(frozen->first.first, boxes[l]->first.first),
+            std::min(frozen->first.second, boxes[l]->first.second)};
+          frozen->second = {std::max(frozen->second.first, boxes[l]->second.first),
+            std::max(frozen->second.second, boxes[l]->second.second)};
+        }
+      }
+    }
+
+    //
+    // Every stripe of every replica is annealed at once, seeds
+    // only depend on the options, the sweep and the stripe
+    //
+    auto work = [&](std::size_t r, std::size_t k)
+    {
+      this->sweep(this->replicas[r], stripes[r][k], this->temperatures[r],
+        random::seed(this->options.seed, r, s, k));
+    };
+
+    executor::for_each(executor, this->replicas.size() * count, 1,
+      [&](std::size_t beg, std::size_t end)
+    {
+      for( auto j{beg}; j < end; ++j ) work(j / count, j % count);
+    });
+
+    //
+    // Stripes are merged back into their replica
+    //
+    for( std::size_t r{0}; r < this->replicas.size(); ++r )
+    {
+      auto& replica { this->replicas[r] };
+      std::vector<std::pair<Cell,T>> entries;
+      for( auto& stripe : stripes[r] )
+      {
+        report.moves += stripe.moves;
+        report.accepted += stripe.accepted;
+        for( auto const& [i, cell] : stripe.moved )
+        {
+          replica.cells[i] = cell;
+          entries.push_back({cell, static_cast<T>(i)});
+        }
+      }
+      replica.placements.move(entries.cbegin(), entries.cend());
+      replica.cost = this->cost(replica);
+
+      if( replica.cost < best_cost )
+      {
+        best = replica.cells;
+        best_cost = replica.cost;
+      }
+
+      this->temperatures[r] *= this->options.cooling;
+    }
+
+    this->exchange(s, report);
+  }
+
+  //
+  // The best placements found are applied as a single batch
+  //
+  std::vector<std::pair<Cell,T>> entries;
+  for( std::size_t i{0}; i < best.size(); ++i )
+  {
+    if( placements.find(this->ids[i]) != best[i] ) entries.push_back({best[i], this->ids[i]});
+  }
+  placements.move(entries.cbegin(), entries.cend());
+
+  auto [w, h] { placements.get_area() };
+  report.wirelength = this->wirelength(best);
+  report.area = static_cast<std::uint64_t>(w) * static_cast<std::uint64_t>(h);
+  report.cost = best_cost;
+
+  report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  if( report.seconds > 0 ) report.moves_per_second = report.moves / report.seconds;
+
+  return report;
+}
+
+//
+// Private Methods
+//
+template<typename T>
+std::uint64_t Annealer<T>::wirelength(std::vector<Cell> const& cells) const noexcept
+{
+  std::uint64_t length {0};
+  for( std::size_t n{0}; n < this->nets.size(); ++n ) length += this->wirelength(cells, n);
+  return length;
+}
+
+template<typename T>
+std::uint64_t Annealer<T>::wirelength(std::vector<Cell> const& cells, std::size_t net) const noexcept
+{
+  auto const& pins { this->nets[net] };
+  auto [x0, y0] { cells[pins.front()] };
+  auto x1 { x0 }, y1 { y0 };
+  for( auto pin : pins )
+  {
+    auto const& [x, y] { cells[pin] };
+    x0 = std::min(x0, x); x1 = std::max(x1, x);
+    y0 = std::min(y0, y); y1 = std::max(y1, y);
+  }
+  return static_cast<std::uint64_t>(x1 - x0) + static_cast<std::uint64_t>(y1 - y0);
+}
+
+template<typename T>
+double Annealer<T>::cost(Replica const& replica) const noexcept
+{
+  auto [w, h] { replica.placements.get_area() };
+  return static_cast<double>(this->wirelength(replica.cells))
+    + this->options.area_weight * static_cast<double>(w) * static_cast<double>(h);
+}
+
+template<typename T>
+void Annealer<T>::sweep(Replica const& replica, Stripe& stripe, double temperature,
+  std::uint64_t seed) const noexcept
+{
+  if( stripe.members.empty() ) return;
+
+  random::Generator generator(seed);
+
+  //
+  // The stripe works on its own copies, placements of the other
+  // stripes are never moved in them
+  //
+  auto cells { replica.cells };
+  placement::Placements<T> shard;
+  for( auto i : stripe.members ) shard.insert({cells[i], static_cast<T>(i)});
+
+  auto area = [&]
+  {
+    auto box { shard.get_bounds() };
+    if( stripe.frozen && box )
+    {
+      box->first = {std::min(box->first.first, stripe.frozen->first.first),
+        std::min(box->first.second, stripe.frozen->first.second)};
+      box->second = {std::max(box->second.first, stripe.frozen->second.first),
+        std::max(box->second.second, stripe.frozen->second.second)};
+    }
+    if( ! box ) return 0.0;
+    return static_cast<double>(box->second.first - box->first.first + 1)
+      * static_cast<double>(box->second.second - box->first.second + 1);
+  };
+
+  std::vector<std::size_t> affected;
+  auto evaluate = [&]
+  {
+    double length {0};
+    for( auto n : affected ) length += static_cast<double>(this->wirelength(cells, n));
+    return length + this->options.area_weight * area();
+  };
+
+  auto range { static_cast<T>(this->options.range) };
+  auto window = [&](T p, T lo, T hi)
+  {
+    if( range <= 0 || p < lo || p > hi ) return std::make_pair(lo, hi);
+    return std::make_pair(static_cast<T>(std::max<std::int64_t>(lo, std::int64_t{p} - range)),
+      static_cast<T>(std::min<std::int64_t>(hi, std::int64_t{p} + range)));
+  };
+
+  for( std::size_t m{0}; m < stripe.members.size(); ++m )
+  {
+    auto i { stripe.members[generator.below(stripe.members.size())] };
+    auto from { cells[i] };
+
+    auto [xl, xh] { window(from.first, stripe.x0, stripe.x1) };
+    auto [yl, yh] { window(from.second, this->a.second, this->b.second) };
+    Cell to { generator.between(xl, xh), generator.between(yl, yh) };
+
+    ++stripe.moves;
+    if( to == from ) continue;
+
+    auto other { shard.at(to) };
+
+    affected.assign(this->incidence.cbegin() + this->offsets[i],
+      this->incidence.cbegin() + this->offsets[i+1]);
+    if( other )
+    {
+      auto j { static_cast<std::size_t>(*other) };
+      affected.insert(affected.end(), this->incidence.cbegin() + this->offsets[j],
+        this->incidence.cbegin() + this->offsets[j+1]);
+      std::sort(affected.begin(), affected.end());
+      affected.erase(std::unique(affected.begin(), affected.end()), affected.end());
+    }
+
+    auto before { evaluate() };
+
+    auto apply = [&](Cell const& p, Cell const& q)
+    {
+      if( other )
+      {
+        std::pair<Cell,T> entries[] { {q, static_cast<T>(i)}, {p, *other} };
+        shard.move(std::cbegin(entries), std::cend(entries));
+        cells[static_cast<std::size_t>(*other)] = p;
+      }
+      else
+      {
+        shard.move(std::make_pair(q, static_cast<T>(i)));
+      }
+      cells[i] = q;
+    };
+
+    apply(from, to);
+
+    auto delta { evaluate() - before };
+
+    if( delta <= 0 || generator.uniform() < std::exp(-delta / temperature) )
+    {
+      ++stripe.accepted;
+    }
+    else
+    {
+      apply(to, from);
+    }
+  }
+
+  for( auto i : stripe.members )
+  {
+    if( cells[i] != replica.cells[i] ) stripe.moved.push_back({i, cells[i]});
+  }
+}
+
+template<typename T>
+void Annealer<T>::exchange(std::size_t sweep, Report& report) noexcept
+{
+  random::Generator generator(random::seed(this->options.seed, sweep));
+
+  //
+  // Neighbouring replicas, alternating between even and odd
+  // pairs, swap their placements with probability
+  // min(1, exp((E_i - E_j)(1/T_i - 1/T_j)))
+  //
+  for( auto r{sweep % 2}; r + 1 < this->replicas.size(); r += 2 )
+  {
+    auto& cold { this->replicas[r] };
+    auto& hot { this->replicas[r+1] };
+    auto p { (cold.cost - hot.cost)
+      * (1 / this->temperatures[r] - 1 / this->temperatures[r+1]) };
+    if( p >= 0 || generator.uniform() < std::exp(p) )
+    {
+      std::swap(cold, hot);
+      ++report.exchanges;
+    }
+  }
+}
+
+//
+// Anneals the placements inside the inclusive region with
+// corners a and b, to shorten the nets of the netlist. Nets
+// hold placement ids, ids without a placement are ignored
+//
+template<typename T>
+Report anneal(placement::Placements<T>& placements, Netlist<T> const& netlist,
+  std::pair<T,T> const& a, std::pair<T,T> const& b,
+  Options const& options = {},
+  executor::Executor* executor = executor::get_default()) noexcept
+{
+  Annealer<T> annealer(placements, netlist, a, b, options);
+  return annealer.run(placements, executor);
+}
+
+} // namespace electra::anneal
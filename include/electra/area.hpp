@@ -10,39 +10,83 @@
 
 #pragma once
 #include <utility>
+#include <cstdint>
 #include <map>
+#include <vector>
+#include <optional>
+#include <iterator>
+#include <algorithm>
+#include <memory_resource>
 
+#include <electra/instrument.hpp>
+#include <electra/memory.hpp>
 #include <nlohmann/json.hpp>
 
 namespace electra::area
 {
   template<typename T>
-  using X = std::map<T, T>;
+  using X = std::pmr::map<T, T>;
   template<typename T>
-  using Y = std::map<T, T>;
+  using Y = std::pmr::map<T, T>;
 
   template<typename T>
   class Area
   {
 
     private:
+      instrument::Counters counters;
       X<T> x_map;
       Y<T> y_map;
     public:
+    // Public Members
+      using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+    // Constructors
+      Area() noexcept;
+      explicit Area(allocator_type const& allocator) noexcept;
     // Public Methods
       // Element Access
       template<typename U = std::vector<std::pair<T,T>>>
       void insert(U&& u) noexcept;
       template<typename U = std::vector<std::pair<T,T>>>
       void erase(U&& u) noexcept;
+      template<typename InIt>
+      void insert(InIt it_beg, InIt it_end) noexcept;
+      template<typename InIt>
+      void erase(InIt it_beg, InIt it_end) noexcept;
       std::pair<T,T> get_area() const noexcept;
+      std::optional<std::pair<std::pair<T,T>,std::pair<T,T>>> get_bounds() const noexcept;
+      instrument::Stats get_stats() const noexcept;
+      memory::Usage memory_usage() const noexcept;
       // Operations
       template<typename _T>
       friend void to_json(nlohmann::json& j, Area<_T> const& area);
       template<typename _T>
       friend void from_json(const nlohmann::json& j, Area<_T>& area);
+    private:
+    // Private Methods
+      template<typename InIt, typename F>
+      static std::vector<std::pair<T,T>> runs(InIt it_beg, InIt it_end, F&& coordinate) noexcept;
+      template<typename M>
+      static void merge(M& map, std::vector<std::pair<T,T>> const& runs, bool insert) noexcept;
   };
 
+  //
+  // Constructors
+  //
+  template<typename T>
+  Area<T>::Area() noexcept
+    : Area(allocator_type{})
+  {
+  }
+
+  template<typename T>
+  Area<T>::Area(allocator_type const& allocator) noexcept
+    : counters(allocator.resource())
+    , x_map(this->counters.resource())
+    , y_map(this->counters.resource())
+  {
+  }
+
   //
   // Public Methods
   //
@@ -50,7 +94,10 @@ namespace electra::area
   template<typename U>
   void Area<T>::insert(U&& u) noexcept
   {
-    for( auto entry : u )
+    auto timer { this->counters.time() };
+    this->counters.count(&instrument::Stats::probes, 2 * std::size(u));
+
+    for( auto const& entry : u )
     {
       auto search_x {x_map.find(entry.first)};
       auto search_y {y_map.find(entry.second)};
@@ -67,7 +114,10 @@ namespace electra::area
   template<typename U>
   void Area<T>::erase(U&& u) noexcept
   {
-    for( auto entry : u )
+    auto timer { this->counters.time() };
+    this->counters.count(&instrument::Stats::probes, 2 * std::size(u));
+
+    for( auto const& entry : u )
     {
       auto search_x {x_map.find(entry.first)};
       auto search_y {y_map.find(entry.second)};
@@ -83,6 +133,42 @@ namespace electra::area
     }
   }
 
+  template<typename T>
+  template<typename InIt>
+  void Area<T>::insert(InIt it_beg, InIt it_end) noexcept
+  {
+    //
+    // Same as insert(u), the cells are counted per coordinate
+    // first, so each coordinate is looked up once
+    //
+    auto timer { this->counters.time() };
+
+    auto xs { runs(it_beg, it_end, [](auto const& cell) { return cell.first; }) };
+    auto ys { runs(it_beg, it_end, [](auto const& cell) { return cell.second; }) };
+    this->counters.count(&instrument::Stats::probes, xs.size() + ys.size());
+
+    merge(this->x_map, xs, true);
+    merge(this->y_map, ys, true);
+  }
+
+  template<typename T>
+  template<typename InIt>
+  void Area<T>::erase(InIt it_beg, InIt it_end) noexcept
+  {
+    //
+    // Counts are taken as a whole, unlike erase(u) coordinates
+    // which are not held are skipped rather than stopping
+    //
+    auto timer { this->counters.time() };
+
+    auto xs { runs(it_beg, it_end, [](auto const& cell) { return cell.first; }) };
+    auto ys { runs(it_beg, it_end, [](auto const& cell) { return cell.second; }) };
+    this->counters.count(&instrument::Stats::probes, xs.size() + ys.size());
+
+    merge(this->x_map, xs, false);
+    merge(this->y_map, ys, false);
+  }
+
   template<typename T>
   std::pair<T,T> Area<T>::get_area() const noexcept
   {
@@ -99,6 +185,100 @@ namespace electra::area
     return {x_delta,y_delta};
   }
 
+  template<typename T>
+  std::optional<std::pair<std::pair<T,T>,std::pair<T,T>>> Area<T>::get_bounds() const noexcept
+  {
+    if(x_map.empty()) return std::nullopt;
+
+    return std::make_pair(
+      std::make_pair(std::begin(x_map)->first, std::begin(y_map)->first),
+      std::make_pair(std::rbegin(x_map)->first, std::rbegin(y_map)->first));
+  }
+
+  template<typename T>
+  instrument::Stats Area<T>::get_stats() const noexcept
+  {
+    return this->counters.get();
+  }
+
+  template<typename T>
+  memory::Usage Area<T>::memory_usage() const noexcept
+  {
+    auto usage { memory::map(this->x_map) };
+    usage += memory::map(this->y_map);
+    return usage;
+  }
+
+  //
+  // Private Methods
+  //
+  template<typename T>
+  template<typename InIt, typename F>
+  std::vector<std::pair<T,T>> Area<T>::runs(InIt it_beg, InIt it_end, F&& coordinate) noexcept
+  {
+    //
+    // Coordinates of a layout are mostly dense, they are
+    // counted in a histogram when their span is close to their
+    // number, and sorted otherwise
+    //
+    std::vector<T> values;
+    for( auto it{it_beg}; it != it_end; ++it ) values.push_back(coordinate(*it));
+
+    std::vector<std::pair<T,T>> runs;
+    if( values.empty() ) return runs;
+
+    auto [min, max] { std::minmax_element(values.cbegin(), values.cend()) };
+    auto lo { *min };
+    auto span { static_cast<std::uint64_t>(*max) - static_cast<std::uint64_t>(lo) };
+
+    if( span < 2 * values.size() + 64 )
+    {
+      auto size { static_cast<std::size_t>(span) + 1 };
+      std::vector<T> histogram(size, 0);
+      for( auto v : values ) ++histogram[static_cast<std::size_t>(v - lo)];
+      for( std::size_t k{0}; k < size; ++k )
+      {
+        if( histogram[k] ) runs.emplace_back(static_cast<T>(lo + static_cast<T>(k)), histogram[k]);
+      }
+      return runs;
+    }
+
+    std::sort(values.begin(), values.end());
+    for( auto v : values )
+    {
+      if( runs.empty() || runs.back().first != v ) runs.emplace_back(v, 0);
+      ++runs.back().second;
+    }
+    return runs;
+  }
+
+  template<typename T>
+  template<typename M>
+  void Area<T>::merge(M& map, std::vector<std::pair<T,T>> const& runs, bool insert) noexcept
+  {
+    //
+    // Runs are sorted, each insertion is hinted with the node
+    // following the previous one
+    //
+    auto hint { map.begin() };
+
+    for( auto const& [value, count] : runs )
+    {
+      if( insert )
+      {
+        hint = map.try_emplace(hint, value, 0);
+        hint->second += count;
+        ++hint;
+        continue;
+      }
+
+      auto search { map.find(value) };
+      if( search == map.end() ) continue;
+      if( search->second <= count ) map.erase(search);
+      else search->second -= count;
+    }
+  }
+
   template<typename _T>
   void to_json(nlohmann::json& j, Area<_T> const& area)
   {
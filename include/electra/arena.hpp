@@ -0,0 +1,142 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : arena
+// @created     : Thursday Oct 22, 2026 14:08:52 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <memory>
+#include <utility>
+#include <cstddef>
+#include <memory_resource>
+
+namespace electra::arena
+{
+
+//
+// Algorithm's Description:
+//   Monotonic memory resource, memory is taken from ever
+//   growing buffers and only given back all at once. Containers
+//   built on an arena neither free their memory nor run the
+//   destructors of their elements, so a throwaway layout is
+//   destroyed in O(1) and its memory reclaimed by release().
+//
+// Cavefeats:
+//   Erased elements are not reclaimed until release(), and an
+//   arena must not be shared between threads.
+//
+class Arena : public std::pmr::memory_resource
+{
+  private:
+  // Private Members
+    std::pmr::monotonic_buffer_resource monotonic;
+    std::size_t bytes;
+  public:
+  // Constructors
+    explicit Arena(std::size_t size = 1 << 16,
+      std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept;
+  // Public Methods
+    // Capacity
+    std::size_t allocated() const noexcept;
+    // Modifiers
+    void release() noexcept;
+  private:
+  // Private Methods
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override;
+};
+
+//
+// Constructors
+//
+inline Arena::Arena(std::size_t size, std::pmr::memory_resource* upstream) noexcept
+  : monotonic(size, upstream)
+  , bytes(0)
+{
+}
+
+//
+// Public Methods
+//
+inline std::size_t Arena::allocated() const noexcept
+{
+  return this->bytes;
+}
+
+inline void Arena::release() noexcept
+{
+  this->monotonic.release();
+  this->bytes = 0;
+}
+
+//
+// Private Methods
+//
+inline void* Arena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+  this->bytes += bytes;
+  return this->monotonic.allocate(bytes, alignment);
+}
+
+inline void Arena::do_deallocate(void*, std::size_t, std::size_t)
+{
+}
+
+inline bool Arena::do_is_equal(std::pmr::memory_resource const& other) const noexcept
+{
+  return this == &other;
+}
+
+//
+// Owning pointer to an object allocated from a memory
+// resource, left alone when the resource is an arena
+//
+template<typename U>
+struct Deleter
+{
+  std::pmr::memory_resource* resource {std::pmr::get_default_resource()};
+
+  void operator()(U* u) const noexcept
+  {
+    if( dynamic_cast<Arena*>(this->resource) ) return;
+    std::pmr::polymorphic_allocator<U> allocator(this->resource);
+    std::allocator_traits<decltype(allocator)>::destroy(allocator, u);
+    allocator.deallocate(u, 1);
+  }
+};
+
+template<typename U>
+using Pointer = std::unique_ptr<U, Deleter<U>>;
+
+//
+// Builds an object in memory of the resource, passing the
+// resource on to it when it is allocator aware
+//
+template<typename U, typename... Args>
+Pointer<U> make(std::pmr::memory_resource* resource, Args&&... args)
+{
+  std::pmr::polymorphic_allocator<U> allocator(resource);
+  auto u { allocator.allocate(1) };
+  allocator.construct(u, std::forward<Args>(args)...);
+  return Pointer<U>(u, Deleter<U>{resource});
+}
+
+//
+// Same as make, for objects owned by more than one container,
+// the control block is taken from the resource as well
+//
+template<typename U, typename... Args>
+std::shared_ptr<U> share(std::pmr::memory_resource* resource, Args&&... args)
+{
+  auto u { make<U>(resource, std::forward<Args>(args)...) };
+  auto deleter { u.get_deleter() };
+  return std::shared_ptr<U>(u.release(), deleter,
+    std::pmr::polymorphic_allocator<std::byte>(resource));
+}
+
+} // namespace electra::arena
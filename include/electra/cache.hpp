@@ -0,0 +1,183 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : cache
+// @created     : Wednesday Oct 21, 2026 16:05:31 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <list>
+#include <algorithm>
+#include <utility>
+#include <cstdint>
+#include <unordered_map>
+
+#include <electra/fingerprint.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+
+namespace electra::cache
+{
+
+// Data types
+using Key = fingerprint::Fingerprint;
+
+//
+// Fingerprint of a layout made of placements and wires
+//
+template<typename T>
+Key key(placement::Placements<T> const& placements, wire::Wires<T> const& wires) noexcept
+{
+  return fingerprint::combine(placements.get_fingerprint(), wires.get_fingerprint());
+}
+
+//
+// Algorithm's Description:
+//   Results of expensive evaluations of layouts, such as
+//   routing or metrics, kept by the fingerprint of the layout.
+//   Once full, the least recently used result is evicted.
+//
+// Cavefeats:
+//   Distinct layouts share a fingerprint with a probability
+//   of about 2^-128 per pair.
+//
+template<typename V>
+class Cache
+{
+  private:
+  // Private Types
+    using Entries = std::list<std::pair<Key,V>>;
+  // Private Members
+    std::size_t limit;
+    Entries entries;
+    std::unordered_map<Key, typename Entries::iterator> index;
+    std::uint64_t hit_count;
+    std::uint64_t miss_count;
+  public:
+  // Constructors
+    explicit Cache(std::size_t capacity) noexcept;
+  // Public Methods
+    // Capacity
+    std::size_t size() const noexcept;
+    std::size_t capacity() const noexcept;
+    std::uint64_t hits() const noexcept;
+    std::uint64_t misses() const noexcept;
+    // Modifiers
+    template<typename U = V>
+    void insert(Key const& key, U&& u) noexcept;
+    void erase(Key const& key) noexcept;
+    void clear() noexcept;
+    // Lookup
+    V const* find(Key const& key) noexcept;
+    // Operations
+    template<typename F>
+    V const& memoize(Key const& key, F&& f) noexcept;
+};
+
+//
+// Constructors
+//
+template<typename V>
+Cache<V>::Cache(std::size_t capacity) noexcept
+  : limit(std::max<std::size_t>(capacity, 1))
+  , hit_count(0)
+  , miss_count(0)
+{
+}
+
+//
+// Public Methods
+//
+template<typename V>
+std::size_t Cache<V>::size() const noexcept
+{
+  return this->entries.size();
+}
+
+template<typename V>
+std::size_t Cache<V>::capacity() const noexcept
+{
+  return this->limit;
+}
+
+template<typename V>
+std::uint64_t Cache<V>::hits() const noexcept
+{
+  return this->hit_count;
+}
+
+template<typename V>
+std::uint64_t Cache<V>::misses() const noexcept
+{
+  return this->miss_count;
+}
+
+template<typename V>
+template<typename U>
+void Cache<V>::insert(Key const& key, U&& u) noexcept
+{
+  auto search { this->index.find(key) };
+  if( search != this->index.end() )
+  {
+    search->second->second = std::forward<U>(u);
+    this->entries.splice(this->entries.begin(), this->entries, search->second);
+    return;
+  }
+
+  if( this->entries.size() >= this->limit )
+  {
+    this->index.erase(this->entries.back().first);
+    this->entries.pop_back();
+  }
+
+  this->entries.emplace_front(key, std::forward<U>(u));
+  this->index.emplace(key, this->entries.begin());
+}
+
+template<typename V>
+void Cache<V>::erase(Key const& key) noexcept
+{
+  auto search { this->index.find(key) };
+  if( search == this->index.end() ) return;
+  this->entries.erase(search->second);
+  this->index.erase(search);
+}
+
+template<typename V>
+void Cache<V>::clear() noexcept
+{
+  this->entries.clear();
+  this->index.clear();
+}
+
+template<typename V>
+V const* Cache<V>::find(Key const& key) noexcept
+{
+  //
+  // A hit makes the entry the most recently used
+  //
+  auto search { this->index.find(key) };
+  if( search == this->index.end() )
+  {
+    ++this->miss_count;
+    return nullptr;
+  }
+
+  ++this->hit_count;
+  this->entries.splice(this->entries.begin(), this->entries, search->second);
+  return &search->second->second;
+}
+
+template<typename V>
+template<typename F>
+V const& Cache<V>::memoize(Key const& key, F&& f) noexcept
+{
+  if( auto found { this->find(key) } ) return *found;
+  this->insert(key, std::forward<F>(f)());
+  return this->entries.front().second;
+}
+
+} // namespace electra::cache
@@ -0,0 +1,661 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : density
+// @created     : Monday Oct 19, 2026 10:21:37 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <tuple>
+#include <vector>
+#include <limits>
+#include <utility>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+#include <unordered_map>
+
+#include <electra/memory.hpp>
+#include <electra/point.hpp>
+
+namespace electra::density
+{
+
+// Data types
+using Count = std::int64_t;
+using Key = std::uint64_t;
+using Low = std::uint16_t;
+
+// Tile limits
+constexpr std::uint32_t SIDE { 64 };
+constexpr std::uint32_t CELLS { SIDE * SIDE };
+constexpr std::size_t SPARSE_MAX { 256 };
+// Tiles along each axis, and rectangles counted tile by tile
+constexpr std::uint32_t TILES { std::uint32_t{1} << 26 };
+constexpr std::uint64_t DIRECT_MAX { 64 };
+
+//
+// Count of a bw x bh block of cells, the column and row are
+// those of the block starting at the origin
+//
+struct Bucket
+{
+  std::size_t column;
+  std::size_t row;
+  Count count;
+};
+using Heatmap = std::vector<Bucket>;
+
+//
+// Counts of the 64x64 cells which share the 52 high bits of
+// their morton code. Sparse tiles keep a sorted array of the
+// cells with a count, dense ones every count and a Fenwick
+// tree over them. Cells are addressed in row major order
+//
+struct Tile
+{
+  // Public Members
+    Count total {0};
+    std::uint32_t cardinality {0};
+    std::vector<std::pair<Low,std::int32_t>> entries;
+    std::vector<std::int32_t> cells;
+    std::vector<std::int32_t> tree;
+  // Public Methods
+    // Lookup
+    std::int32_t at(Low low) const noexcept;
+    Count count(std::uint32_t x1, std::uint32_t y1,
+      std::uint32_t x2, std::uint32_t y2) const noexcept;
+    template<typename F>
+    void for_each(F&& f) const;
+    // Modifiers
+    void add(Low low, std::int32_t delta) noexcept;
+    void to_dense() noexcept;
+    void to_sparse() noexcept;
+  private:
+  // Private Methods
+    Count prefix(std::uint32_t i, std::uint32_t j) const noexcept;
+};
+
+inline std::int32_t Tile::at(Low low) const noexcept
+{
+  if( ! this->cells.empty() ) return this->cells[low];
+
+  auto it { std::lower_bound(this->entries.cbegin(), this->entries.cend(), low,
+    [](auto const& entry, Low value){ return entry.first < value; }) };
+  return it != this->entries.cend() && it->first == low ? it->second : 0;
+}
+
+inline Count Tile::count(std::uint32_t x1, std::uint32_t y1,
+  std::uint32_t x2, std::uint32_t y2) const noexcept
+{
+  if( x1 == 0 && y1 == 0 && x2 == SIDE-1 && y2 == SIDE-1 ) return this->total;
+
+  if( this->cells.empty() )
+  {
+    Count sum{0};
+    for( auto const& [low, n] : this->entries )
+    {
+      auto x { low % SIDE };
+      auto y { low / SIDE };
+      if( x >= x1 && x <= x2 && y >= y1 && y <= y2 ) sum += n;
+    }
+    return sum;
+  }
+
+  return this->prefix(y2+1,x2+1) - this->prefix(y1,x2+1)
+    - this->prefix(y2+1,x1) + this->prefix(y1,x1);
+}
+
+template<typename F>
+void Tile::for_each(F&& f) const
+{
+  if( this->cells.empty() )
+  {
+    for( auto const& [low, n] : this->entries ) f(low, n);
+    return;
+  }
+
+  for( std::uint32_t low{0}; low < CELLS; ++low )
+  {
+    if( this->cells[low] != 0 ) f(static_cast<Low>(low), this->cells[low]);
+  }
+}
+
+inline void Tile::add(Low low, std::int32_t delta) noexcept
+{
+  this->total += delta;
+
+  if( ! this->cells.empty() )
+  {
+    auto before { this->cells[low] };
+    this->cells[low] += delta;
+    if( before == 0 ) ++this->cardinality;
+    if( this->cells[low] == 0 ) --this->cardinality;
+
+    // Row and column indices are 0-based, a |= a+1 walks up
+    for( std::uint32_t a{low / SIDE}; a < SIDE; a |= a+1 )
+    {
+      for( std::uint32_t b{low % SIDE}; b < SIDE; b |= b+1 )
+      {
+        this->tree[a*SIDE+b] += delta;
+      }
+    }
+
+    // Half the limit, so tiles at the limit do not flip back and forth
+    if( this->cardinality <= SPARSE_MAX / 2 ) this->to_sparse();
+    return;
+  }
+
+  auto it { std::lower_bound(this->entries.begin(), this->entries.end(), low,
+    [](auto const& entry, Low value){ return entry.first < value; }) };
+
+  if( it != this->entries.end() && it->first == low )
+  {
+    it->second += delta;
+    if( it->second == 0 )
+    {
+      this->entries.erase(it);
+      --this->cardinality;
+    }
+    return;
+  }
+
+  this->entries.insert(it, {low, delta});
+  if( ++this->cardinality > SPARSE_MAX ) this->to_dense();
+}
+
+inline void Tile::to_dense() noexcept
+{
+  this->cells.assign(CELLS, 0);
+  for( auto const& [low, n] : this->entries ) this->cells[low] = n;
+  this->entries = {};
+
+  //
+  // Linear time construction, each node pushes its partial sum
+  // to its parent, first along the rows then along the columns
+  //
+  this->tree = this->cells;
+
+  for( std::uint32_t i{0}; i < SIDE; ++i )
+  {
+    for( std::uint32_t j{0}; j < SIDE; ++j )
+    {
+      auto p { j | (j+1) };
+      if( p < SIDE ) this->tree[i*SIDE+p] += this->tree[i*SIDE+j];
+    }
+  }
+
+  for( std::uint32_t i{0}; i < SIDE; ++i )
+  {
+    auto p { i | (i+1) };
+    if( p >= SIDE ) continue;
+    for( std::uint32_t j{0}; j < SIDE; ++j )
+    {
+      this->tree[p*SIDE+j] += this->tree[i*SIDE+j];
+    }
+  }
+}
+
+inline void Tile::to_sparse() noexcept
+{
+  this->entries.clear();
+  this->entries.reserve(this->cardinality);
+  this->for_each([&](Low low, std::int32_t n){ this->entries.emplace_back(low, n); });
+  this->cells = {};
+  this->tree = {};
+}
+
+inline Count Tile::prefix(std::uint32_t i, std::uint32_t j) const noexcept
+{
+  // Sum of the rows before i and the columns before j
+  Count sum{0};
+  for( auto a{i}; a > 0; a &= a-1 )
+  {
+    for( auto b{j}; b > 0; b &= b-1 )
+    {
+      sum += this->tree[(a-1)*SIDE+(b-1)];
+    }
+  }
+  return sum;
+}
+
+//
+// Algorithm's Description:
+//   Keeps the number of occupied cells per coordinate in
+//   64x64 tiles, ordered by the morton code of the tile; tiles
+//   without cells take no memory, so the map scales with the
+//   occupied tiles rather than with its bounding box. Tiles
+//   with few cells keep them in a sorted array, the others a
+//   two dimensional Fenwick tree, see Tile. The totals of the
+//   tiles are kept in another two dimensional Fenwick tree over
+//   the tile coordinates, its nodes in a hash table so that only
+//   the ones reached by an occupied tile are stored. A rectangle
+//   count takes the tiles it covers whole from that tree in
+//   O(log(TILES)^2), and clips the ones along its border in
+//   O(log(64)^2) each.
+//
+// Cavefeats:
+//   Changes to the tile totals are gathered and only added to
+//   the tree by the next count of a large rectangle, so counts
+//   are not safe to run concurrently. Small rectangles look up
+//   each of their tiles instead.
+//
+template<typename T>
+class Density
+{
+  private:
+  // Private Members
+    std::vector<Key> keys;
+    std::vector<Tile> tiles;
+    mutable std::unordered_map<Key,Count> totals;
+    mutable std::unordered_map<Key,Count> pending;
+  public:
+  // Constructors
+    Density() noexcept;
+  // Public Methods
+    // Capacity
+    std::pair<std::size_t,std::size_t> extent() const noexcept;
+    std::pair<T,T> origin() const noexcept;
+    memory::Usage memory_usage() const noexcept;
+    // Modifiers
+    template<typename U = std::vector<std::pair<T,T>>>
+    void insert(U&& u) noexcept;
+    template<typename U = std::vector<std::pair<T,T>>>
+    void erase(U&& u) noexcept;
+    void clear() noexcept;
+    void shrink_to_fit() noexcept;
+    // Lookup
+    Count count(std::pair<T,T> const& a, std::pair<T,T> const& b) const noexcept;
+    Count at(std::pair<T,T> const& a) const noexcept;
+    Heatmap heatmap(std::size_t bw, std::size_t bh) const noexcept;
+  private:
+  // Private Methods
+    // Lookup
+    std::size_t lower_bound(Key key) const noexcept;
+    std::pair<std::uint32_t,std::uint32_t> corner() const noexcept;
+    Count prefix(std::uint32_t tx, std::uint32_t ty) const noexcept;
+    // Modifiers
+    void flush() const noexcept;
+  public:
+  // Static Assertions
+    static_assert(std::is_integral<T>::value, "T must be of an integral type");
+    static_assert(std::is_signed<T>::value, "T must be of a signed type");
+};
+
+//
+// Tile of a biased cell and its position inside of it
+//
+inline Key key(std::uint32_t x, std::uint32_t y) noexcept
+{
+  return point::spread(x / SIDE) | (point::spread(y / SIDE) << 1);
+}
+
+inline Low low(std::uint32_t x, std::uint32_t y) noexcept
+{
+  return static_cast<Low>((y % SIDE) * SIDE + x % SIDE);
+}
+
+//
+// Constructors
+//
+template<typename T>
+Density<T>::Density() noexcept
+{
+  //
+  // Checked here rather than with the class, containers of
+  // wider types still name the map but can not enable it
+  //
+  static_assert(sizeof(T) <= 4, "T must fit in 32 bits");
+}
+
+//
+// Public Methods
+//
+template<typename T>
+std::pair<std::size_t,std::size_t> Density<T>::extent() const noexcept
+{
+  //
+  // Bounding box of the occupied tiles
+  //
+  if( this->keys.empty() ) return {0,0};
+
+  std::uint32_t x_max{0}, y_max{0};
+  for( auto k : this->keys )
+  {
+    x_max = std::max(x_max, point::compact(k));
+    y_max = std::max(y_max, point::compact(k >> 1));
+  }
+
+  auto [x_min, y_min] { this->corner() };
+  return {(std::size_t{x_max} + 1) * SIDE - x_min,
+    (std::size_t{y_max} + 1) * SIDE - y_min};
+}
+
+template<typename T>
+std::pair<T,T> Density<T>::origin() const noexcept
+{
+  if( this->keys.empty() ) return {0,0};
+  auto [x, y] { this->corner() };
+  return {point::unbias<T>(x), point::unbias<T>(y)};
+}
+
+template<typename T>
+memory::Usage Density<T>::memory_usage() const noexcept
+{
+  //
+  // Keys, tile headers and trees are the index, the counts of
+  // the cells are the payload
+  //
+  auto usage { memory::vector(this->keys) };
+  usage += memory::vector(this->tiles);
+  usage += memory::hash(this->totals);
+  usage += memory::hash(this->pending);
+  usage.index += usage.payload;
+  usage.payload = 0;
+
+  for( auto const& tile : this->tiles )
+  {
+    usage += memory::vector(tile.entries);
+    usage += memory::vector(tile.cells);
+    auto tree { memory::vector(tile.tree) };
+    tree.index += tree.payload;
+    tree.payload = 0;
+    usage += tree;
+  }
+
+  return usage;
+}
+
+template<typename T>
+template<typename U>
+void Density<T>::insert(U&& u) noexcept
+{
+  for( auto const& entry : u )
+  {
+    auto x { point::bias(entry.first) };
+    auto y { point::bias(entry.second) };
+    auto k { density::key(x,y) };
+    auto index { this->lower_bound(k) };
+
+    if( index == this->keys.size() || this->keys[index] != k )
+    {
+      this->keys.insert(this->keys.begin()+index, k);
+      this->tiles.emplace(this->tiles.begin()+index);
+    }
+
+    this->tiles[index].add(density::low(x,y), 1);
+    ++this->pending[k];
+  }
+}
+
+template<typename T>
+template<typename U>
+void Density<T>::erase(U&& u) noexcept
+{
+  for( auto const& entry : u )
+  {
+    auto x { point::bias(entry.first) };
+    auto y { point::bias(entry.second) };
+    auto k { density::key(x,y) };
+    auto index { this->lower_bound(k) };
+
+    if( index == this->keys.size() || this->keys[index] != k ) continue;
+
+    auto& tile { this->tiles[index] };
+    if( tile.at(density::low(x,y)) <= 0 ) continue;
+
+    tile.add(density::low(x,y), -1);
+    --this->pending[k];
+
+    if( tile.total == 0 )
+    {
+      this->keys.erase(this->keys.begin()+index);
+      this->tiles.erase(this->tiles.begin()+index);
+    }
+  }
+}
+
+template<typename T>
+void Density<T>::clear() noexcept
+{
+  *this = Density<T>{};
+}
+
+template<typename T>
+void Density<T>::shrink_to_fit() noexcept
+{
+  this->keys.shrink_to_fit();
+  this->tiles.shrink_to_fit();
+  for( auto& tile : this->tiles ) tile.entries.shrink_to_fit();
+  this->flush();
+  this->pending = {};
+}
+
+template<typename T>
+Count Density<T>::count(std::pair<T,T> const& a,
+  std::pair<T,T> const& b) const noexcept
+{
+  if( this->keys.empty() ) return 0;
+
+  auto x1 { point::bias(std::min(a.first, b.first)) };
+  auto x2 { point::bias(std::max(a.first, b.first)) };
+  auto y1 { point::bias(std::min(a.second, b.second)) };
+  auto y2 { point::bias(std::max(a.second, b.second)) };
+
+  //
+  // Clip the inclusive rectangle to the tile at tx,ty
+  //
+  Count sum{0};
+  auto add = [&](std::uint32_t tx, std::uint32_t ty, Tile const& tile)
+  {
+    sum += tile.count(
+      tx == x1 / SIDE ? x1 % SIDE : 0, ty == y1 / SIDE ? y1 % SIDE : 0,
+      tx == x2 / SIDE ? x2 % SIDE : SIDE-1, ty == y2 / SIDE ? y2 % SIDE : SIDE-1);
+  };
+  auto visit = [&](std::uint32_t tx, std::uint32_t ty)
+  {
+    auto k { point::spread(tx) | (point::spread(ty) << 1) };
+    auto index { this->lower_bound(k) };
+    if( index < this->keys.size() && this->keys[index] == k ) add(tx, ty, this->tiles[index]);
+  };
+
+  std::uint32_t tx1 { x1 / SIDE }, tx2 { x2 / SIDE };
+  std::uint32_t ty1 { y1 / SIDE }, ty2 { y2 / SIDE };
+  auto cols { std::uint64_t{tx2} - tx1 + 1 };
+  auto rows { std::uint64_t{ty2} - ty1 + 1 };
+
+  if( cols * rows <= DIRECT_MAX )
+  {
+    for( auto ty{ty1}; ty <= ty2; ++ty )
+      for( auto tx{tx1}; tx <= tx2; ++tx ) visit(tx, ty);
+    return sum;
+  }
+
+  //
+  // Tiles covered whole come from the tree, the first and last
+  // column and row are whole unless the rectangle cuts them
+  //
+  std::int64_t fx1 { tx1 + (x1 % SIDE != 0) }, fx2 { std::int64_t{tx2} - (x2 % SIDE != SIDE-1) };
+  std::int64_t fy1 { ty1 + (y1 % SIDE != 0) }, fy2 { std::int64_t{ty2} - (y2 % SIDE != SIDE-1) };
+  bool whole { fx1 <= fx2 && fy1 <= fy2 };
+  auto inside = [&](std::int64_t tx, std::int64_t ty)
+  {
+    return whole && tx >= fx1 && tx <= fx2 && ty >= fy1 && ty <= fy2;
+  };
+
+  std::uint64_t border { cols * rows };
+  if( whole )
+  {
+    this->flush();
+    auto i1 { static_cast<std::uint32_t>(fx1) }, i2 { static_cast<std::uint32_t>(fx2+1) };
+    auto j1 { static_cast<std::uint32_t>(fy1) }, j2 { static_cast<std::uint32_t>(fy2+1) };
+    sum += this->prefix(i2,j2) - this->prefix(i1,j2) - this->prefix(i2,j1) + this->prefix(i1,j1);
+    border -= std::uint64_t(fx2 - fx1 + 1) * std::uint64_t(fy2 - fy1 + 1);
+  }
+
+  //
+  // The border is looked up tile by tile, unless the map holds
+  // fewer tiles than it, then every tile of the map is checked
+  //
+  if( border <= this->keys.size() )
+  {
+    for( auto ty{ty1}; ty <= ty2; ++ty )
+    {
+      if( ! inside(fx1, ty) )
+      {
+        for( auto tx{tx1}; tx <= tx2; ++tx ) visit(tx, ty);
+        continue;
+      }
+      for( auto tx{tx1}; tx < fx1; ++tx ) visit(tx, ty);
+      for( auto tx{static_cast<std::uint32_t>(fx2+1)}; tx <= tx2; ++tx ) visit(tx, ty);
+    }
+    return sum;
+  }
+
+  for( std::size_t index{0}; index < this->keys.size(); ++index )
+  {
+    auto tx { point::compact(this->keys[index]) };
+    auto ty { point::compact(this->keys[index] >> 1) };
+    if( tx < tx1 || tx > tx2 || ty < ty1 || ty > ty2 || inside(tx, ty) ) continue;
+    add(tx, ty, this->tiles[index]);
+  }
+
+  return sum;
+}
+
+template<typename T>
+Count Density<T>::at(std::pair<T,T> const& a) const noexcept
+{
+  auto x { point::bias(a.first) };
+  auto y { point::bias(a.second) };
+  auto k { density::key(x,y) };
+  auto index { this->lower_bound(k) };
+
+  if( index == this->keys.size() || this->keys[index] != k ) return 0;
+
+  return this->tiles[index].at(density::low(x,y));
+}
+
+template<typename T>
+Heatmap Density<T>::heatmap(std::size_t bw, std::size_t bh) const noexcept
+{
+  //
+  // Buckets of bw x bh cells aligned to the origin, only the
+  // ones with a count are kept, in row major order. Tiles
+  // fall whole into one bucket when both sides are multiples
+  // of the tile side, so their totals are added at once
+  //
+  if( bw == 0 || bh == 0 || this->keys.empty() ) return {};
+
+  auto [x0, y0] { this->corner() };
+  bool whole { bw % SIDE == 0 && bh % SIDE == 0 };
+
+  Heatmap buckets;
+  for( std::size_t index{0}; index < this->keys.size(); ++index )
+  {
+    auto tx { std::size_t{point::compact(this->keys[index])} * SIDE - x0 };
+    auto ty { std::size_t{point::compact(this->keys[index] >> 1)} * SIDE - y0 };
+    auto const& tile { this->tiles[index] };
+
+    if( whole )
+    {
+      buckets.push_back({tx / bw, ty / bh, tile.total});
+      continue;
+    }
+
+    tile.for_each([&](Low low, std::int32_t n)
+    {
+      buckets.push_back({(tx + low % SIDE) / bw, (ty + low / SIDE) / bh, n});
+    });
+  }
+
+  std::sort(buckets.begin(), buckets.end(), [](Bucket const& a, Bucket const& b)
+  {
+    return std::tie(a.row, a.column) < std::tie(b.row, b.column);
+  });
+
+  // Merge the counts that fell into the same bucket
+  std::size_t n{0};
+  for( auto const& bucket : buckets )
+  {
+    if( n > 0 && buckets[n-1].row == bucket.row && buckets[n-1].column == bucket.column )
+    {
+      buckets[n-1].count += bucket.count;
+      continue;
+    }
+    buckets[n++] = bucket;
+  }
+  buckets.resize(n);
+
+  return buckets;
+}
+
+//
+// Private Methods
+//
+template<typename T>
+std::size_t Density<T>::lower_bound(Key key) const noexcept
+{
+  return static_cast<std::size_t>(std::distance(this->keys.cbegin(),
+    std::lower_bound(this->keys.cbegin(), this->keys.cend(), key)));
+}
+
+template<typename T>
+std::pair<std::uint32_t,std::uint32_t> Density<T>::corner() const noexcept
+{
+  // Lowest biased corner of the occupied tiles
+  auto x { std::numeric_limits<std::uint32_t>::max() };
+  auto y { std::numeric_limits<std::uint32_t>::max() };
+  for( auto k : this->keys )
+  {
+    x = std::min(x, point::compact(k) * SIDE);
+    y = std::min(y, point::compact(k >> 1) * SIDE);
+  }
+  return {x, y};
+}
+
+template<typename T>
+Count Density<T>::prefix(std::uint32_t tx, std::uint32_t ty) const noexcept
+{
+  // Totals of the tiles before column tx and row ty
+  Count sum{0};
+  for( auto a{tx}; a > 0; a &= a-1 )
+  {
+    for( auto b{ty}; b > 0; b &= b-1 )
+    {
+      auto it { this->totals.find((Key{a} << 32) | b) };
+      if( it != this->totals.end() ) sum += it->second;
+    }
+  }
+  return sum;
+}
+
+//
+// Modifiers
+//
+template<typename T>
+void Density<T>::flush() const noexcept
+{
+  //
+  // Adds the gathered changes of the tile totals to the tree,
+  // nodes are 1-based and dropped once they are back to zero
+  //
+  for( auto const& [k, delta] : this->pending )
+  {
+    if( delta == 0 ) continue;
+    for( auto a{point::compact(k) + 1}; a <= TILES; a += a & (~a + 1) )
+    {
+      for( auto b{point::compact(k >> 1) + 1}; b <= TILES; b += b & (~b + 1) )
+      {
+        auto it { this->totals.try_emplace((Key{a} << 32) | b, 0).first };
+        if( (it->second += delta) == 0 ) this->totals.erase(it);
+      }
+    }
+  }
+  this->pending.clear();
+}
+
+} // namespace electra::density
@@ -0,0 +1,570 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : distance
+// @created     : Tuesday Oct 20, 2026 09:05:31 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <optional>
+#include <algorithm>
+#include <unordered_map>
+#include <type_traits>
+
+#include <electra/occupancy.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+
+namespace electra::distance
+{
+
+// Data types
+using Word = std::uint64_t;
+using Distance = std::uint32_t;
+
+constexpr Distance INF { std::numeric_limits<Distance>::max() };
+
+//
+// Algorithm's Description:
+//   Keeps the occupancy of a rectangular window as rows of
+//   64-cell words. The nearest free cell of a query is found
+//   by a wavefront growing one row at a time away from it,
+//   each row being scanned a word at a time; rows further
+//   than the best distance found so far are never visited.
+//   The distance field, the distance from each cell to its
+//   nearest free cell, is built by dilating the free cells
+//   with word shifts until the window is covered. Once built
+//   it is kept up to date in place: a freed cell lowers the
+//   distances around it with a breadth first search, an
+//   occupied one clears the cells whose distance may have
+//   come through it and fills them again from their borders.
+// Cavefeats:
+//   The window takes (w*h)/8 bytes for the occupancy plus
+//   4*w*h bytes once the distance field is queried
+//
+template<typename T>
+class Field
+{
+  private:
+  // Private Members
+    T x0;
+    T y0;
+    std::size_t width;
+    std::size_t height;
+    std::size_t words;
+    std::vector<Word> bits;
+    std::unordered_map<std::size_t,std::uint32_t> shared;
+    mutable std::vector<Distance> field;
+    mutable bool dirty;
+  public:
+  // Constructors
+    Field(std::pair<T,T> const& a, std::pair<T,T> const& b) noexcept;
+  // Public Methods
+    // Capacity
+    std::pair<std::size_t,std::size_t> extent() const noexcept;
+    // Modifiers
+    template<typename U = std::vector<std::pair<T,T>>>
+    void insert(U&& u) noexcept;
+    template<typename U = std::vector<std::pair<T,T>>>
+    void erase(U&& u) noexcept;
+    void load(placement::Placements<T> const& placements) noexcept;
+    void load(wire::Wires<T> const& wires) noexcept;
+    void load(occupancy::Occupancy<T> const& occupancy) noexcept;
+    // Lookup
+    bool occupied(std::pair<T,T> const& a) const noexcept;
+    std::optional<Distance> distance(std::pair<T,T> const& a) const noexcept;
+    std::optional<std::pair<T,T>> nearest(std::pair<T,T> const& a) const noexcept;
+    template<typename InIt, typename OutIt>
+    void nearest(InIt&& it_beg, InIt&& it_end, OutIt&& out) const;
+    template<typename InIt, typename OutIt>
+    void claim(InIt&& it_beg, InIt&& it_end, OutIt&& out);
+  private:
+  // Private Methods
+    // Lookup
+    std::optional<std::size_t> index(std::pair<T,T> const& a) const noexcept;
+    Word valid(std::size_t w) const noexcept;
+    std::optional<std::size_t> right(std::size_t r, std::size_t c, std::size_t limit) const noexcept;
+    std::optional<std::size_t> left(std::size_t r, std::size_t c, std::size_t limit) const noexcept;
+    // Operations
+    void build() const noexcept;
+    void relax(std::size_t i) noexcept;
+    void raise(std::size_t i) noexcept;
+    void lower(std::vector<std::pair<Distance,std::size_t>>& seeds) noexcept;
+  public:
+  // Static Assertions
+    static_assert(std::is_integral<T>::value, "T must be of an integral type");
+    static_assert(std::is_signed<T>::value, "T must be of a signed type");
+};
+
+//
+// Constructors
+//
+template<typename T>
+Field<T>::Field(std::pair<T,T> const& a, std::pair<T,T> const& b) noexcept
+  : x0(std::min(a.first, b.first))
+  , y0(std::min(a.second, b.second))
+  , width(static_cast<std::size_t>(std::max(a.first, b.first) - x0) + 1)
+  , height(static_cast<std::size_t>(std::max(a.second, b.second) - y0) + 1)
+  , words((width + 63) / 64)
+  , bits(words*height, 0)
+  , dirty(true)
+{
+}
+
+//
+// Public Methods
+//
+template<typename T>
+std::pair<std::size_t,std::size_t> Field<T>::extent() const noexcept
+{
+  return {this->width, this->height};
+}
+
+template<typename T>
+template<typename U>
+void Field<T>::insert(U&& u) noexcept
+{
+  for( auto const& entry : u )
+  {
+    auto i { this->index(entry) };
+    if( ! i ) continue;
+
+    auto& w { this->bits[(*i / this->width)*this->words + (*i % this->width)/64] };
+    auto bit { Word{1} << ((*i % this->width) & 63) };
+
+    if( w & bit ) { ++this->shared[*i]; continue; }
+
+    //
+    // A free cell got occupied, distances around it may grow
+    //
+    w |= bit;
+    if( ! this->dirty ) this->raise(*i);
+  }
+}
+
+template<typename T>
+template<typename U>
+void Field<T>::erase(U&& u) noexcept
+{
+  for( auto const& entry : u )
+  {
+    auto i { this->index(entry) };
+    if( ! i ) continue;
+
+    if( auto search {this->shared.find(*i)}; search != this->shared.end() )
+    {
+      if( --search->second == 0 ) this->shared.erase(search);
+      continue;
+    }
+
+    auto& w { this->bits[(*i / this->width)*this->words + (*i % this->width)/64] };
+    auto bit { Word{1} << ((*i % this->width) & 63) };
+
+    if( !(w & bit) ) continue;
+
+    //
+    // A cell got freed, distances around it can only shrink
+    //
+    w &= ~bit;
+    if( ! this->dirty ) this->relax(*i);
+  }
+}
+
+template<typename T>
+void Field<T>::load(placement::Placements<T> const& placements) noexcept
+{
+  for( auto it{placements.cbegin()}; it != placements.cend(); ++it )
+  {
+    this->insert({it->first});
+  }
+}
+
+template<typename T>
+void Field<T>::load(wire::Wires<T> const& wires) noexcept
+{
+  for( auto it{wires.cbegin()}; it != wires.cend(); ++it )
+  {
+    this->insert(*it);
+  }
+}
+
+template<typename T>
+void Field<T>::load(occupancy::Occupancy<T> const& occupancy) noexcept
+{
+  occupancy.for_each([&](auto const& cell){ this->insert({cell}); });
+}
+
+template<typename T>
+bool Field<T>::occupied(std::pair<T,T> const& a) const noexcept
+{
+  auto i { this->index(a) };
+  if( ! i ) return false;
+  auto r { *i / this->width };
+  auto c { *i % this->width };
+  return (this->bits[r*this->words + c/64] >> (c & 63)) & 1;
+}
+
+template<typename T>
+std::optional<Distance> Field<T>::distance(std::pair<T,T> const& a) const noexcept
+{
+  auto i { this->index(a) };
+  if( ! i ) return std::nullopt;
+
+  if( this->dirty ) this->build();
+
+  if( this->field[*i] == INF ) return std::nullopt;
+  return this->field[*i];
+}
+
+template<typename T>
+std::optional<std::pair<T,T>> Field<T>::nearest(std::pair<T,T> const& a) const noexcept
+{
+  //
+  // Queries outside the window start from the closest
+  // column of the window, paying the distance to it
+  //
+  auto x_max { static_cast<T>(this->x0 + static_cast<T>(this->width) - 1) };
+  auto cx { std::clamp(a.first, this->x0, x_max) };
+  auto c { static_cast<std::size_t>(cx - this->x0) };
+  auto base { static_cast<std::size_t>(cx > a.first ? cx - a.first : a.first - cx) };
+
+  auto y_max { static_cast<T>(this->y0 + static_cast<T>(this->height) - 1) };
+  auto cy { std::clamp(a.second, this->y0, y_max) };
+  auto r0 { static_cast<std::size_t>(cy - this->y0) };
+  auto dy0 { static_cast<std::size_t>(cy > a.second ? cy - a.second : a.second - cy) };
+
+  std::size_t best { std::numeric_limits<std::size_t>::max() };
+  std::optional<std::pair<std::size_t,std::size_t>> found;
+
+  auto visit = [&](std::size_t r, std::size_t dy)
+  {
+    auto cost { base + dy };
+    if( cost >= best ) return;
+    auto limit { best - cost - 1 };
+
+    auto dr { this->right(r, c, limit) };
+    auto dl { this->left(r, c, dr ? std::min(limit, *dr) : limit) };
+
+    if( dl && (! dr || *dl < *dr) )
+    {
+      best = cost + *dl;
+      found = std::make_pair(r, c - *dl);
+    }
+    else if( dr )
+    {
+      best = cost + *dr;
+      found = std::make_pair(r, c + *dr);
+    }
+  };
+
+  //
+  // Grow the wavefront one row above and below at a time
+  //
+  for( std::size_t k{0}; ; ++k )
+  {
+    auto up { r0 >= k };
+    auto down { r0 + k < this->height };
+
+    if( ! up && ! down ) break;
+    if( base + dy0 + k >= best ) break;
+
+    if( up ) visit(r0 - k, dy0 + k);
+    if( down && k != 0 ) visit(r0 + k, dy0 + k);
+  }
+
+  if( ! found ) return std::nullopt;
+
+  return std::make_pair(static_cast<T>(this->x0 + static_cast<T>(found->second)),
+    static_cast<T>(this->y0 + static_cast<T>(found->first)));
+}
+
+template<typename T>
+template<typename InIt, typename OutIt>
+void Field<T>::nearest(InIt&& it_beg, InIt&& it_end, OutIt&& out) const
+{
+  //
+  // Answer the queries row by row so that consecutive searches
+  // touch the same words, results keep the order of the input
+  //
+  std::vector<std::pair<T,T>> queries(it_beg, it_end);
+  std::vector<std::size_t> order(queries.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](auto l, auto r)
+  {
+    return std::tie(queries[l].second, queries[l].first)
+      < std::tie(queries[r].second, queries[r].first);
+  });
+
+  std::vector<std::optional<std::pair<T,T>>> results(queries.size());
+  for( auto i : order ) results[i] = this->nearest(queries[i]);
+
+  std::copy(results.cbegin(), results.cend(), out);
+}
+
+template<typename T>
+template<typename InIt, typename OutIt>
+void Field<T>::claim(InIt&& it_beg, InIt&& it_end, OutIt&& out)
+{
+  //
+  // Greedy legalization, each query occupies the free cell it
+  // receives so that no two queries get the same cell
+  //
+  for( auto it{it_beg}; it != it_end; ++it )
+  {
+    auto cell { this->nearest(*it) };
+    if( cell ) this->insert({*cell});
+    *out = cell;
+    ++out;
+  }
+}
+
+//
+// Private Methods
+//
+template<typename T>
+std::optional<std::size_t> Field<T>::index(std::pair<T,T> const& a) const noexcept
+{
+  if( a.first < this->x0 || a.second < this->y0 ) return std::nullopt;
+
+  auto c { static_cast<std::size_t>(a.first - this->x0) };
+  auto r { static_cast<std::size_t>(a.second - this->y0) };
+
+  if( c >= this->width || r >= this->height ) return std::nullopt;
+
+  return r*this->width + c;
+}
+
+template<typename T>
+Word Field<T>::valid(std::size_t w) const noexcept
+{
+  auto tail { this->width & 63 };
+  if( w + 1 == this->words && tail ) return (Word{1} << tail) - 1;
+  return ~Word{0};
+}
+
+template<typename T>
+std::optional<std::size_t> Field<T>::right(std::size_t r, std::size_t c,
+  std::size_t limit) const noexcept
+{
+  auto row { this->bits.data() + r*this->words };
+  auto w { c / 64 };
+  auto free { ~row[w] & this->valid(w) & (~Word{0} << (c & 63)) };
+
+  while( true )
+  {
+    if( free )
+    {
+      auto dx { (w*64 + occupancy::countr_zero(free)) - c };
+      if( dx > limit ) return std::nullopt;
+      return dx;
+    }
+    if( ++w == this->words || w*64 - c > limit ) return std::nullopt;
+    free = ~row[w] & this->valid(w);
+  }
+}
+
+template<typename T>
+std::optional<std::size_t> Field<T>::left(std::size_t r, std::size_t c,
+  std::size_t limit) const noexcept
+{
+  auto row { this->bits.data() + r*this->words };
+  auto w { c / 64 };
+  auto upto { (c & 63) == 63 ? ~Word{0} : (Word{1} << ((c & 63) + 1)) - 1 };
+  auto free { ~row[w] & this->valid(w) & upto };
+
+  while( true )
+  {
+    if( free )
+    {
+      auto dx { c - (w*64 + 63 - occupancy::countl_zero(free)) };
+      if( dx > limit ) return std::nullopt;
+      return dx;
+    }
+    if( w == 0 || c - (w*64 - 1) > limit ) return std::nullopt;
+    --w;
+    free = ~row[w] & this->valid(w);
+  }
+}
+
+template<typename T>
+void Field<T>::build() const noexcept
+{
+  //
+  // Multi source dilation of the free cells, the k-th step
+  // reaches the cells at distance k from the free ones
+  //
+  auto n { this->words*this->height };
+
+  std::vector<Word> reached(n), next(n);
+  this->field.assign(this->width*this->height, INF);
+
+  auto mark = [&](std::vector<Word> const& fresh, Distance d)
+  {
+    bool any{false};
+    for( std::size_t r{0}; r < this->height; ++r )
+    {
+      for( std::size_t w{0}; w < this->words; ++w )
+      {
+        for( auto bits{fresh[r*this->words+w]}; bits; bits &= bits-1 )
+        {
+          this->field[r*this->width + w*64 + occupancy::countr_zero(bits)] = d;
+          any = true;
+        }
+      }
+    }
+    return any;
+  };
+
+  for( std::size_t i{0}; i < n; ++i )
+  {
+    reached[i] = ~this->bits[i] & this->valid(i % this->words);
+  }
+
+  if( ! mark(reached, 0) ) { this->dirty = false; return; }
+
+  for( Distance d{1}; ; ++d )
+  {
+    for( std::size_t r{0}; r < this->height; ++r )
+    {
+      auto row { reached.data() + r*this->words };
+      for( std::size_t w{0}; w < this->words; ++w )
+      {
+        auto v { row[w] };
+        v |= row[w] << 1;
+        v |= row[w] >> 1;
+        if( w > 0 ) v |= row[w-1] >> 63;
+        if( w + 1 < this->words ) v |= row[w+1] << 63;
+        if( r > 0 ) v |= reached[(r-1)*this->words + w];
+        if( r + 1 < this->height ) v |= reached[(r+1)*this->words + w];
+        next[r*this->words + w] = v & this->valid(w);
+      }
+    }
+
+    for( std::size_t i{0}; i < n; ++i )
+    {
+      auto fresh { next[i] & ~reached[i] };
+      reached[i] = fresh;
+    }
+
+    if( ! mark(reached, d) ) break;
+
+    reached.swap(next);
+  }
+
+  this->dirty = false;
+}
+
+template<typename T>
+void Field<T>::relax(std::size_t i) noexcept
+{
+  // The freed cell is the only source, see lower
+  std::vector<std::pair<Distance,std::size_t>> seeds {{0, i}};
+  this->field[i] = 0;
+  this->lower(seeds);
+}
+
+template<typename T>
+void Field<T>::raise(std::size_t i) noexcept
+{
+  //
+  // Cells whose distance may have come through the occupied
+  // cell are one further than a neighbour already taken,
+  // starting from it. They are cleared, and filled again
+  // from the cells around them that were not taken
+  //
+  std::vector<std::pair<Distance,std::size_t>> taken {{this->field[i], i}};
+  this->field[i] = INF;
+
+  for( std::size_t n{0}; n < taken.size(); ++n )
+  {
+    auto [d, j] { taken[n] };
+    auto r { j / this->width };
+    auto c { j % this->width };
+
+    auto take = [&](std::size_t k)
+    {
+      if( this->field[k] == INF || this->field[k] != d + 1 ) return;
+      taken.emplace_back(this->field[k], k);
+      this->field[k] = INF;
+    };
+
+    if( c > 0 ) take(j-1);
+    if( c + 1 < this->width ) take(j+1);
+    if( r > 0 ) take(j-this->width);
+    if( r + 1 < this->height ) take(j+this->width);
+  }
+
+  std::vector<std::pair<Distance,std::size_t>> seeds;
+  for( auto const& [d, j] : taken )
+  {
+    auto r { j / this->width };
+    auto c { j % this->width };
+
+    auto seed = [&](std::size_t k)
+    {
+      if( this->field[k] != INF ) seeds.emplace_back(this->field[k], k);
+    };
+
+    if( c > 0 ) seed(j-1);
+    if( c + 1 < this->width ) seed(j+1);
+    if( r > 0 ) seed(j-this->width);
+    if( r + 1 < this->height ) seed(j+this->width);
+  }
+
+  this->lower(seeds);
+}
+
+template<typename T>
+void Field<T>::lower(std::vector<std::pair<Distance,std::size_t>>& seeds) noexcept
+{
+  //
+  // Breadth first search from cells of known distances, a
+  // seed joins the wavefront once it reaches its distance;
+  // only cells whose distance shrinks are expanded
+  //
+  std::sort(seeds.begin(), seeds.end());
+
+  std::vector<std::size_t> frontier, upcoming;
+  std::size_t next {0};
+
+  for( Distance d{0}; next < seeds.size() || ! frontier.empty(); ++d )
+  {
+    if( frontier.empty() ) d = seeds[next].first;
+    for( ; next < seeds.size() && seeds[next].first == d; ++next )
+    {
+      frontier.push_back(seeds[next].second);
+    }
+
+    upcoming.clear();
+    for( auto j : frontier )
+    {
+      // Lowered again since it was queued
+      if( this->field[j] != d ) continue;
+
+      auto r { j / this->width };
+      auto c { j % this->width };
+
+      auto push = [&](std::size_t k)
+      {
+        if( this->field[k] > d + 1 ) { this->field[k] = d + 1; upcoming.push_back(k); }
+      };
+
+      if( c > 0 ) push(j-1);
+      if( c + 1 < this->width ) push(j+1);
+      if( r > 0 ) push(j-this->width);
+      if( r + 1 < this->height ) push(j+this->width);
+    }
+    frontier.swap(upcoming);
+  }
+}
+
+} // namespace electra::distance
@@ -0,0 +1,374 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : executor
+// @created     : Friday Oct 30, 2026 09:12:40 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <condition_variable>
+
+namespace electra::executor
+{
+
+// Work of a bulk call, ran once for each index
+using Task = std::function<void(std::size_t)>;
+
+//
+// Runs the tasks of the containers, as memory resources do
+// their allocations; derived classes plug other schedulers in,
+// such as the one of an application, by overriding do_bulk.
+// Tasks must not throw
+//
+class Executor
+{
+  public:
+  // Constructors
+    virtual ~Executor() = default;
+  // Public Methods
+    // Runs task(k) for each k in [0,count), returns once all did
+    void bulk(std::size_t count, Task const& task);
+    // Tasks that may run at the same time
+    std::size_t concurrency() const noexcept;
+  private:
+  // Private Methods
+    virtual void do_bulk(std::size_t count, Task const& task) = 0;
+    virtual std::size_t do_concurrency() const noexcept = 0;
+};
+
+//
+// Runs the tasks in order on the calling thread, the default
+//
+class Inline final : public Executor
+{
+  private:
+  // Private Methods
+    void do_bulk(std::size_t count, Task const& task) override;
+    std::size_t do_concurrency() const noexcept override;
+};
+
+//
+// Algorithm's Description:
+//   Work stealing pool. Each worker owns a queue of jobs, it
+//   takes the newest ones from the back, and once it runs out
+//   it steals the oldest ones from the front of the others. A
+//   bulk call splits its indices in contiguous blocks, one per
+//   queue, and the calling thread steals as well until all of
+//   them ran, so a pool of n threads starts n - 1 workers. A
+//   bulk call from inside a task pushes to the queue of its
+//   worker, which keeps running jobs while it waits.
+//
+// Cavefeats:
+//   Queues are guarded by a mutex each, jobs should be coarse
+//   enough for the lock to not matter, see for_each.
+//
+class Pool final : public Executor
+{
+  private:
+  // Private Types
+    struct Batch
+    {
+      Task const* task;
+      std::atomic<std::size_t> remaining;
+    };
+    struct Job
+    {
+      Batch* batch;
+      std::size_t index;
+    };
+    struct Queue
+    {
+      std::mutex mutex;
+      std::deque<Job> jobs;
+    };
+  // Private Members
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::atomic<std::size_t> pending;
+    bool stop;
+  public:
+  // Constructors
+    explicit Pool(std::size_t threads = std::thread::hardware_concurrency());
+    Pool(Pool const&) = delete;
+    Pool& operator=(Pool const&) = delete;
+    ~Pool() override;
+  private:
+  // Private Methods
+    void do_bulk(std::size_t count, Task const& task) override;
+    std::size_t do_concurrency() const noexcept override;
+    void work(std::size_t queue) noexcept;
+    bool pop(std::size_t queue, Job& job) noexcept;
+    bool steal(std::size_t queue, Job& job) noexcept;
+    std::size_t current() const noexcept;
+    static void run(Job const& job) noexcept;
+    static std::pair<Pool const*,std::size_t>& worker() noexcept;
+};
+
+//
+// Constructors
+//
+inline Pool::Pool(std::size_t threads)
+  : pending(0)
+  , stop(false)
+{
+  threads = std::max<std::size_t>(threads, 1);
+
+  // The last queue belongs to the threads outside of the pool
+  for( std::size_t k{0}; k < threads; ++k )
+  {
+    this->queues.push_back(std::make_unique<Queue>());
+  }
+  for( std::size_t k{0}; k + 1 < threads; ++k )
+  {
+    this->workers.emplace_back([this, k] { this->work(k); });
+  }
+}
+
+inline Pool::~Pool()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->stop = true;
+  }
+  this->wake.notify_all();
+  for( auto& worker : this->workers ) worker.join();
+}
+
+//
+// Public Methods
+//
+inline void Executor::bulk(std::size_t count, Task const& task)
+{
+  if( count == 0 ) return;
+  if( count == 1 ) { task(0); return; }
+  this->do_bulk(count, task);
+}
+
+inline std::size_t Executor::concurrency() const noexcept
+{
+  return this->do_concurrency();
+}
+
+//
+// Private Methods
+//
+inline void Inline::do_bulk(std::size_t count, Task const& task)
+{
+  for( std::size_t k{0}; k < count; ++k ) task(k);
+}
+
+inline std::size_t Inline::do_concurrency() const noexcept
+{
+  return 1;
+}
+
+inline void Pool::do_bulk(std::size_t count, Task const& task)
+{
+  Batch batch {&task, {count}};
+
+  // Counted before they are pushed, so thieves never go below zero
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->pending += count;
+  }
+
+  //
+  // From outside of the pool the blocks are spread over every
+  // queue, from a worker they all go to its own queue and the
+  // idle workers steal them
+  //
+  auto self { this->current() };
+  auto size { this->queues.size() };
+  for( std::size_t q{0}; q < size; ++q )
+  {
+    auto beg { q * count / size };
+    auto end { (q + 1) * count / size };
+    auto& queue { *this->queues[self < size ? self : q] };
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    for( auto k{beg}; k < end; ++k ) queue.jobs.push_back({&batch, k});
+  }
+  this->wake.notify_all();
+
+  auto queue { self < size ? self : size - 1 };
+  Job job;
+  while( batch.remaining.load(std::memory_order_acquire) > 0 )
+  {
+    if( this->pop(queue, job) || this->steal(queue, job) )
+    {
+      run(job);
+    }
+    else
+    {
+      std::this_thread::yield();
+    }
+  }
+}
+
+inline std::size_t Pool::do_concurrency() const noexcept
+{
+  return this->queues.size();
+}
+
+inline void Pool::work(std::size_t queue) noexcept
+{
+  worker() = {this, queue};
+
+  Job job;
+  while( true )
+  {
+    if( this->pop(queue, job) || this->steal(queue, job) )
+    {
+      run(job);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->wake.wait(lock, [this] { return this->stop || this->pending > 0; });
+    if( this->stop && this->pending == 0 ) return;
+  }
+}
+
+inline bool Pool::pop(std::size_t queue, Job& job) noexcept
+{
+  auto& q { *this->queues[queue] };
+  std::lock_guard<std::mutex> lock(q.mutex);
+  if( q.jobs.empty() ) return false;
+  job = q.jobs.back();
+  q.jobs.pop_back();
+  --this->pending;
+  return true;
+}
+
+inline bool Pool::steal(std::size_t queue, Job& job) noexcept
+{
+  // Victims are visited starting from the next queue
+  for( std::size_t k{1}; k < this->queues.size(); ++k )
+  {
+    auto& q { *this->queues[(queue + k) % this->queues.size()] };
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if( q.jobs.empty() ) continue;
+    job = q.jobs.front();
+    q.jobs.pop_front();
+    --this->pending;
+    return true;
+  }
+  return false;
+}
+
+inline void Pool::run(Job const& job) noexcept
+{
+  (*job.batch->task)(job.index);
+  // Last access to the batch, its caller may return after it
+  job.batch->remaining.fetch_sub(1, std::memory_order_release);
+}
+
+inline std::size_t Pool::current() const noexcept
+{
+  // Queue of the calling thread, past the end outside of the pool
+  auto [pool, queue] { worker() };
+  return pool == this ? queue : this->queues.size();
+}
+
+inline std::pair<Pool const*,std::size_t>& Pool::worker() noexcept
+{
+  thread_local std::pair<Pool const*,std::size_t> worker {nullptr, 0};
+  return worker;
+}
+
+//
+// Default executor
+//
+inline Inline* serial() noexcept
+{
+  static Inline serial;
+  return &serial;
+}
+
+inline std::atomic<Executor*>& fallback() noexcept
+{
+  static std::atomic<Executor*> executor {serial()};
+  return executor;
+}
+
+inline Executor* get_default() noexcept
+{
+  return fallback().load();
+}
+
+//
+// Replaces the executor used when none is given, null restores
+// the inline one; returns the previous executor
+//
+inline Executor* set_default(Executor* executor) noexcept
+{
+  return fallback().exchange(executor ? executor : serial());
+}
+
+//
+// Algorithm's Description:
+//   Splits [0,n) in chunks of grain indices and runs
+//   f(begin,end) for each one. The bounds of the chunks only
+//   depend on n and grain, so results written at their index,
+//   or reduced per chunk in chunk order, are the same on any
+//   executor. A grain of zero picks four chunks per task that
+//   may run at once, of at least 256 indices each.
+//
+template<typename F>
+void for_each(Executor* executor, std::size_t n, std::size_t grain, F&& f)
+{
+  if( grain == 0 ) grain = std::max<std::size_t>(n / (4 * executor->concurrency()), 256);
+
+  auto chunks { (n + grain - 1) / grain };
+  executor->bulk(chunks, [&](std::size_t k)
+  {
+    f(k * grain, std::min(n, (k + 1) * grain));
+  });
+}
+
+//
+// Chunks of the range are stable sorted in parallel, then
+// merged pairwise; the result is the one of std::stable_sort,
+// whatever the executor and the grain
+//
+template<typename RandIt, typename Compare = std::less<>>
+void sort(Executor* executor, RandIt it_beg, RandIt it_end,
+  Compare comp = {}, std::size_t grain = 0)
+{
+  auto n { static_cast<std::size_t>(std::distance(it_beg, it_end)) };
+  if( grain == 0 ) grain = std::max<std::size_t>(n / executor->concurrency(), 1 << 12);
+
+  for_each(executor, n, grain, [&](std::size_t beg, std::size_t end)
+  {
+    std::stable_sort(it_beg + beg, it_beg + end, comp);
+  });
+
+  for( auto width{grain}; width < n; width *= 2 )
+  {
+    auto pairs { (n + 2 * width - 1) / (2 * width) };
+    executor->bulk(pairs, [&](std::size_t k)
+    {
+      auto beg { k * 2 * width };
+      auto mid { std::min(n, beg + width) };
+      auto end { std::min(n, beg + 2 * width) };
+      std::inplace_merge(it_beg + beg, it_beg + mid, it_beg + end, comp);
+    });
+  }
+}
+
+} // namespace electra::executor
@@ -0,0 +1,125 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : fingerprint
+// @created     : Wednesday Oct 21, 2026 15:12:48 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <functional>
+
+#include <electra/random.hpp>
+
+namespace electra::fingerprint
+{
+
+//
+// Algorithm's Description:
+//   Zobrist style hashing, each element of a container has a
+//   pseudo random 128 bit key and the fingerprint of the
+//   container is the sum of the keys of its elements. Inserting
+//   or erasing an element adds or subtracts its key, so the
+//   fingerprint is kept in O(1), and it does not depend on the
+//   order elements were inserted. Keys are added rather than
+//   xor-ed so that repeated elements do not cancel out.
+//
+struct Fingerprint
+{
+  std::uint64_t lo {0};
+  std::uint64_t hi {0};
+
+  Fingerprint& operator+=(Fingerprint const& other) noexcept
+  {
+    this->lo += other.lo;
+    this->hi += other.hi;
+    return *this;
+  }
+
+  Fingerprint& operator-=(Fingerprint const& other) noexcept
+  {
+    this->lo -= other.lo;
+    this->hi -= other.hi;
+    return *this;
+  }
+
+  friend Fingerprint operator+(Fingerprint l, Fingerprint const& r) noexcept { return l += r; }
+  friend Fingerprint operator-(Fingerprint l, Fingerprint const& r) noexcept { return l -= r; }
+
+  friend bool operator==(Fingerprint const& l, Fingerprint const& r) noexcept
+  {
+    return l.lo == r.lo && l.hi == r.hi;
+  }
+
+  friend bool operator!=(Fingerprint const& l, Fingerprint const& r) noexcept
+  {
+    return ! (l == r);
+  }
+
+  friend bool operator<(Fingerprint const& l, Fingerprint const& r) noexcept
+  {
+    return std::tie(l.hi, l.lo) < std::tie(r.hi, r.lo);
+  }
+};
+
+// Salts of the two halves of each kind of key
+inline constexpr std::uint64_t PLACEMENT_LO { 0x8A5CD789635D2DFFull };
+inline constexpr std::uint64_t PLACEMENT_HI { 0x121FD2155C472F96ull };
+inline constexpr std::uint64_t WIRE_LO { 0xC2B2AE3D27D4EB4Full };
+inline constexpr std::uint64_t WIRE_HI { 0x165667B19E3779F9ull };
+
+//
+// Key of a placement of id at the given cell
+//
+template<typename T>
+Fingerprint placement(std::pair<T,T> const& cell, T id) noexcept
+{
+  return { random::seed(PLACEMENT_LO, cell.first, cell.second, id),
+    random::seed(PLACEMENT_HI, cell.first, cell.second, id) };
+}
+
+//
+// Key of an encoded wire, in O(segments), the order of its
+// elements is kept so a wire and its reverse differ
+//
+template<typename U>
+Fingerprint wire(U&& encoded) noexcept
+{
+  Fingerprint key { WIRE_LO, WIRE_HI };
+  for( auto const& element : encoded )
+  {
+    key.lo = random::seed(key.lo, element.first, element.second);
+    key.hi = random::seed(key.hi, element.first, element.second);
+  }
+  return key;
+}
+
+//
+// Ordered combination of fingerprints, such as the ones of
+// the placements and the wires of a layout
+//
+inline Fingerprint combine(Fingerprint const& l, Fingerprint const& r) noexcept
+{
+  return { random::seed(l.lo, r.lo, r.hi), random::seed(l.hi, r.hi, r.lo) };
+}
+
+} // namespace electra::fingerprint
+
+namespace std
+{
+
+template<>
+struct hash<electra::fingerprint::Fingerprint>
+{
+  std::size_t operator()(electra::fingerprint::Fingerprint const& key) const noexcept
+  {
+    return static_cast<std::size_t>(key.lo ^ (key.hi * 0x9E3779B97F4A7C15ull));
+  }
+};
+
+} // namespace std
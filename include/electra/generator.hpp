@@ -0,0 +1,137 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : generator
+// @created     : Friday Oct 23, 2026 09:32:17 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#if __has_include(<version>)
+#include <version>
+#endif
+
+//
+// Coroutines are only available from C++20, everything built
+// on them is left out of C++17 builds
+//
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+#define ELECTRA_COROUTINES 1
+#endif
+
+#ifdef ELECTRA_COROUTINES
+
+#include <memory>
+#include <utility>
+#include <iterator>
+#include <exception>
+#include <coroutine>
+
+namespace electra::generator
+{
+
+//
+// Algorithm's Description:
+//   Lazy sequence produced by a coroutine, which runs until
+//   its next co_yield each time the iterator is advanced. A
+//   generator is a single pass input range.
+//
+template<typename T>
+class Generator
+{
+  public:
+  // Public Types
+    struct promise_type
+    {
+      T const* value {nullptr};
+      std::exception_ptr exception;
+
+      Generator get_return_object() noexcept
+      {
+        return Generator{std::coroutine_handle<promise_type>::from_promise(*this)};
+      }
+      std::suspend_always initial_suspend() noexcept { return {}; }
+      std::suspend_always final_suspend() noexcept { return {}; }
+      std::suspend_always yield_value(T const& t) noexcept
+      {
+        this->value = std::addressof(t);
+        return {};
+      }
+      void return_void() noexcept {}
+      void unhandled_exception() noexcept { this->exception = std::current_exception(); }
+    };
+
+    struct sentinel {};
+
+    class iterator
+    {
+      private:
+      // Private Members
+        std::coroutine_handle<promise_type> handle;
+      public:
+      // Public Members
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T const*;
+        using reference = T const&;
+      // Constructors
+        iterator() noexcept = default;
+        explicit iterator(std::coroutine_handle<promise_type> handle) noexcept
+          : handle(handle) {}
+      // Operators
+        iterator& operator++()
+        {
+          this->handle.resume();
+          if( this->handle.promise().exception )
+          {
+            std::rethrow_exception(this->handle.promise().exception);
+          }
+          return *this;
+        }
+        void operator++(int) { ++*this; }
+        T const& operator*() const noexcept { return *this->handle.promise().value; }
+        T const* operator->() const noexcept { return this->handle.promise().value; }
+        friend bool operator==(iterator const& it, sentinel) noexcept
+        {
+          return ! it.handle || it.handle.done();
+        }
+    };
+  private:
+  // Private Members
+    std::coroutine_handle<promise_type> handle;
+  public:
+  // Constructors
+    explicit Generator(std::coroutine_handle<promise_type> handle) noexcept
+      : handle(handle) {}
+    Generator(Generator&& other) noexcept
+      : handle(std::exchange(other.handle, {})) {}
+    Generator& operator=(Generator&& other) noexcept
+    {
+      if( this != &other )
+      {
+        if( this->handle ) this->handle.destroy();
+        this->handle = std::exchange(other.handle, {});
+      }
+      return *this;
+    }
+    Generator(Generator const&) = delete;
+    Generator& operator=(Generator const&) = delete;
+    ~Generator()
+    {
+      if( this->handle ) this->handle.destroy();
+    }
+  // Iterators
+    iterator begin()
+    {
+      if( this->handle ) ++iterator{this->handle};
+      return iterator{this->handle};
+    }
+    sentinel end() const noexcept { return {}; }
+};
+
+} // namespace electra::generator
+
+#endif
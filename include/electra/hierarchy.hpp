@@ -0,0 +1,691 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : hierarchy
+// @created     : Saturday Oct 24, 2026 14:37:52 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <cmath>
+#include <deque>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+#include <electra/memory.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+#include <electra/timeline.hpp>
+
+namespace electra::hierarchy
+{
+
+// Data types
+template<typename T>
+using Cell = std::pair<T,T>;
+template<typename T>
+using Bounds = std::pair<Cell<T>,Cell<T>>;
+using Path = std::vector<std::size_t>;
+
+//
+// Maps the cells of a definition to its parent, cells are
+// mirrored on the x axis first, then rotated by quarter turns,
+// (x,y) to (-y,x), and then translated by the offset
+//
+template<typename T>
+struct Transform
+{
+  Cell<T> offset {0,0};
+  int rotation {0};
+  bool mirror {false};
+
+  Cell<T> apply(Cell<T> cell) const noexcept
+  {
+    if( this->mirror ) cell.first = -cell.first;
+    for( int k{0}; k < (this->rotation % 4 + 4) % 4; ++k )
+    {
+      cell = { static_cast<T>(-cell.second), cell.first };
+    }
+    return { cell.first + this->offset.first, cell.second + this->offset.second };
+  }
+
+  Cell<T> invert(Cell<T> cell) const noexcept
+  {
+    cell = { cell.first - this->offset.first, cell.second - this->offset.second };
+    for( int k{0}; k < (this->rotation % 4 + 4) % 4; ++k )
+    {
+      cell = { cell.second, static_cast<T>(-cell.first) };
+    }
+    if( this->mirror ) cell.first = -cell.first;
+    return cell;
+  }
+
+  Bounds<T> apply(Bounds<T> const& bounds) const noexcept
+  {
+    auto [a, b] = bounds;
+    Cell<T> corners[] { this->apply(a), this->apply(b),
+      this->apply({a.first,b.second}), this->apply({b.first,a.second}) };
+
+    Bounds<T> result { corners[0], corners[0] };
+    for( auto const& c : corners )
+    {
+      result.first = { std::min(result.first.first, c.first), std::min(result.first.second, c.second) };
+      result.second = { std::max(result.second.first, c.first), std::max(result.second.second, c.second) };
+    }
+    return result;
+  }
+};
+
+template<typename T>
+struct Instance
+{
+  std::size_t definition;
+  Transform<T> transform;
+};
+
+//
+// A sub-layout, its content is stored once and shared by
+// every instance of it
+//
+template<typename T>
+struct Definition
+{
+  placement::Placements<T> placements;
+  wire::Wires<T> wires;
+  std::vector<Instance<T>> instances;
+};
+
+//
+// Access to the content of a definition, given by edit. While
+// one is alive every query recomputes the cached bounds, and
+// they are recomputed once more after it is destroyed; its
+// references must not outlive it. Instances are only added
+// through instantiate, which rejects cycles
+//
+template<typename T>
+class Edit
+{
+  private:
+  // Private Members
+    bool& stale;
+    std::size_t& editing;
+  public:
+  // Public Members
+    placement::Placements<T>& placements;
+    wire::Wires<T>& wires;
+  // Constructors
+    Edit(Definition<T>& definition, bool& stale, std::size_t& editing) noexcept;
+    Edit(Edit const&) = delete;
+    Edit& operator=(Edit const&) = delete;
+    ~Edit() noexcept;
+};
+
+template<typename T>
+Edit<T>::Edit(Definition<T>& definition, bool& stale, std::size_t& editing) noexcept
+  : stale(stale)
+  , editing(editing)
+  , placements(definition.placements)
+  , wires(definition.wires)
+{
+  ++this->editing;
+  this->stale = true;
+}
+
+template<typename T>
+Edit<T>::~Edit() noexcept
+{
+  --this->editing;
+  this->stale = true;
+}
+
+//
+// A placement found through the hierarchy, the path holds the
+// instance indices from the top definition down to the one
+// holding the id
+//
+template<typename T>
+struct Hit
+{
+  Path path;
+  T id;
+};
+
+//
+// Algorithm's Description:
+//   Definitions are kept once, definition 0 is the top one. Each
+//   definition holds its own placements and wires, and instances
+//   of other definitions with a transform. Queries walk the
+//   instances on demand, mapping the cell into the definition
+//   coordinates with the inverse transform. The bounds of every
+//   definition are cached, and recomputed after an edit; with
+//   them each definition keeps a grid of buckets over the boxes
+//   of its instances in its own coordinates, a query probes only
+//   the instances listed in the bucket of the cell, in instance
+//   order.
+//
+// Cavefeats:
+//   Buckets are sized to the mean instance box, an instance much
+//   larger than the others is listed in every bucket it covers.
+//   Placement ids are local to their definition, see Hit.
+//
+template<typename T>
+class Hierarchy
+{
+  private:
+  // Private Types
+    struct Grid
+    {
+      Cell<T> origin;
+      std::uint64_t width;
+      std::uint64_t height;
+      std::size_t columns;
+      std::size_t rows;
+      std::vector<Bounds<T>> boxes;
+      std::vector<std::size_t> offsets;
+      std::vector<std::size_t> members;
+    };
+  // Private Members
+    std::deque<Definition<T>> definitions;
+    mutable std::vector<std::optional<Bounds<T>>> bounds;
+    mutable std::vector<Grid> grids;
+    mutable bool stale;
+    std::size_t editing;
+  public:
+  // Constructors
+    Hierarchy() noexcept;
+  // Public Methods
+    // Capacity
+    std::size_t size() const noexcept;
+    std::size_t placements() const noexcept;
+    memory::Usage memory_usage() const noexcept;
+    // Modifiers
+    std::size_t define() noexcept;
+    Edit<T> edit(std::size_t definition) noexcept;
+    std::optional<std::size_t> instantiate(std::size_t parent,
+      std::size_t definition, Transform<T> const& transform) noexcept;
+    void shrink_to_fit() noexcept;
+    // Lookup
+    Definition<T> const& get(std::size_t definition) const noexcept;
+    std::optional<Hit<T>> at(Cell<T> const& cell) const noexcept;
+    std::optional<Cell<T>> find(Hit<T> const& hit) const noexcept;
+    std::optional<Bounds<T>> get_bounds() const noexcept;
+    Cell<T> get_area() const noexcept;
+    // Operations
+    template<typename F>
+    void for_each(F&& f) const;
+    template<typename F>
+    void for_each_wire(F&& f) const;
+    void flatten(placement::Placements<T>& placements, wire::Wires<T>& wires) const noexcept;
+    template<typename F>
+    void flatten(placement::Placements<T>& placements, wire::Wires<T>& wires, F&& id) const;
+  private:
+  // Private Methods
+    // Lookup
+    bool reaches(std::size_t from, std::size_t to) const noexcept;
+    std::optional<Bounds<T>> const& bounds_of(std::size_t definition) const noexcept;
+    Grid const& grid_of(std::size_t definition) const noexcept;
+    std::optional<Hit<T>> at(std::size_t definition, Cell<T> const& cell) const noexcept;
+    // Operations
+    template<typename F>
+    void walk(std::size_t definition, Path& path,
+      std::vector<Transform<T>>& chain, F& f) const;
+    static Cell<T> resolve(std::vector<Transform<T>> const& chain, Cell<T> cell) noexcept;
+  public:
+  // Static Assertions
+    static_assert(std::is_integral<T>::value, "T must be of an integral type");
+    static_assert(std::is_signed<T>::value, "T must be of a signed type");
+};
+
+//
+// Constructors
+//
+template<typename T>
+Hierarchy<T>::Hierarchy() noexcept
+  : definitions(1)
+  , stale(true)
+  , editing(0)
+{
+}
+
+//
+// Public Methods
+//
+template<typename T>
+std::size_t Hierarchy<T>::size() const noexcept
+{
+  return this->definitions.size();
+}
+
+template<typename T>
+std::size_t Hierarchy<T>::placements() const noexcept
+{
+  //
+  // Counted per definition, each one once
+  //
+  std::vector<std::optional<std::size_t>> count(this->definitions.size());
+  std::function<std::size_t(std::size_t)> total = [&](std::size_t d) -> std::size_t
+  {
+    if( count[d] ) return *count[d];
+    std::size_t n { this->definitions[d].placements.size() };
+    for( auto const& instance : this->definitions[d].instances )
+    {
+      n += total(instance.definition);
+    }
+    count[d] = n;
+    return n;
+  };
+  return total(0);
+}
+
+template<typename T>
+memory::Usage Hierarchy<T>::memory_usage() const noexcept
+{
+  //
+  // Definitions are counted once, however many instances of
+  // them there are; the blocks of the deque are not counted
+  //
+  memory::Usage usage;
+  usage.index = this->definitions.size() * sizeof(Definition<T>);
+
+  for( auto const& definition : this->definitions )
+  {
+    usage += definition.placements.memory_usage();
+    usage += definition.wires.memory_usage();
+    usage += memory::vector(definition.instances);
+  }
+
+  auto bounds { memory::vector(this->bounds) };
+  bounds += memory::vector(this->grids);
+  for( auto const& grid : this->grids )
+  {
+    bounds += memory::vector(grid.boxes);
+    bounds += memory::vector(grid.offsets);
+    bounds += memory::vector(grid.members);
+  }
+  bounds.index += bounds.payload;
+  bounds.payload = 0;
+  usage += bounds;
+
+  return usage;
+}
+
+template<typename T>
+std::size_t Hierarchy<T>::define() noexcept
+{
+  this->definitions.emplace_back();
+  this->stale = true;
+  return this->definitions.size() - 1;
+}
+
+template<typename T>
+Edit<T> Hierarchy<T>::edit(std::size_t definition) noexcept
+{
+  //
+  // The caller may change the placements and wires through
+  // the edit, the cached bounds are kept stale until it ends
+  //
+  return {this->definitions[definition], this->stale, this->editing};
+}
+
+template<typename T>
+std::optional<std::size_t> Hierarchy<T>::instantiate(std::size_t parent,
+  std::size_t definition, Transform<T> const& transform) noexcept
+{
+  if( parent >= this->definitions.size() || definition >= this->definitions.size() )
+    return std::nullopt;
+
+  // A definition may not hold itself
+  if( this->reaches(definition, parent) ) return std::nullopt;
+
+  auto& instances { this->definitions[parent].instances };
+  instances.push_back({definition, transform});
+  this->stale = true;
+
+  return instances.size() - 1;
+}
+
+template<typename T>
+void Hierarchy<T>::shrink_to_fit() noexcept
+{
+  for( auto& definition : this->definitions )
+  {
+    definition.placements.shrink_to_fit();
+    definition.wires.shrink_to_fit();
+    definition.instances.shrink_to_fit();
+  }
+  this->definitions.shrink_to_fit();
+}
+
+template<typename T>
+Definition<T> const& Hierarchy<T>::get(std::size_t definition) const noexcept
+{
+  return this->definitions[definition];
+}
+
+template<typename T>
+std::optional<Hit<T>> Hierarchy<T>::at(Cell<T> const& cell) const noexcept
+{
+  return this->at(0, cell);
+}
+
+template<typename T>
+std::optional<Cell<T>> Hierarchy<T>::find(Hit<T> const& hit) const noexcept
+{
+  std::size_t definition {0};
+  std::vector<Transform<T>> chain;
+
+  for( auto index : hit.path )
+  {
+    auto const& instances { this->definitions[definition].instances };
+    if( index >= instances.size() ) return std::nullopt;
+    chain.push_back(instances[index].transform);
+    definition = instances[index].definition;
+  }
+
+  auto region { this->definitions[definition].placements.find(hit.id) };
+  if( ! region ) return std::nullopt;
+
+  return resolve(chain, *region);
+}
+
+template<typename T>
+std::optional<Bounds<T>> Hierarchy<T>::get_bounds() const noexcept
+{
+  return this->bounds_of(0);
+}
+
+template<typename T>
+Cell<T> Hierarchy<T>::get_area() const noexcept
+{
+  auto bounds { this->get_bounds() };
+  if( ! bounds ) return {0,0};
+
+  return { (bounds->second.first + 1) - bounds->first.first,
+    (bounds->second.second + 1) - bounds->first.second };
+}
+
+//
+// Operations
+//
+template<typename T>
+template<typename F>
+void Hierarchy<T>::for_each(F&& f) const
+{
+  //
+  // Calls f(region, id, path) for every placement of every
+  // instance, in the top coordinates
+  //
+  Path path;
+  std::vector<Transform<T>> chain;
+  auto visit = [&](std::size_t definition)
+  {
+    auto const& placements { this->definitions[definition].placements };
+    for( auto it{placements.id_cbegin()}; it != placements.id_cend(); ++it )
+    {
+      f(resolve(chain, it->second), it->first, std::as_const(path));
+    }
+  };
+  this->walk(0, path, chain, visit);
+}
+
+template<typename T>
+template<typename F>
+void Hierarchy<T>::for_each_wire(F&& f) const
+{
+  //
+  // Calls f(cells, path) for every wire of every instance,
+  // decoded in the top coordinates
+  //
+  Path path;
+  std::vector<Transform<T>> chain;
+  std::vector<Cell<T>> cells;
+  auto visit = [&](std::size_t definition)
+  {
+    auto const& wires { this->definitions[definition].wires };
+    for( auto it{wires.cbegin()}; it != wires.cend(); ++it )
+    {
+      cells.clear();
+      for( auto const& cell : *it ) cells.push_back(resolve(chain, cell));
+      f(std::as_const(cells), std::as_const(path));
+    }
+  };
+  this->walk(0, path, chain, visit);
+}
+
+template<typename T>
+void Hierarchy<T>::flatten(placement::Placements<T>& placements,
+  wire::Wires<T>& wires) const noexcept
+{
+  // Ids are given in the order placements are visited
+  T next {0};
+  this->flatten(placements, wires, [&](Path const&, T) { return next++; });
+}
+
+template<typename T>
+template<typename F>
+void Hierarchy<T>::flatten(placement::Placements<T>& placements,
+  wire::Wires<T>& wires, F&& id) const
+{
+  timeline::Scope scope {"hierarchy.flatten"};
+
+  //
+  // Every instance is expanded into the given containers,
+  // id(path, local id) gives the id of each placement
+  //
+  this->for_each([&](Cell<T> const& region, T local, Path const& path)
+  {
+    placements.insert(std::make_pair(region, id(path, local)));
+  });
+  this->for_each_wire([&](std::vector<Cell<T>> const& cells, Path const&)
+  {
+    wires.insert(cells);
+  });
+}
+
+//
+// Private Methods
+//
+template<typename T>
+bool Hierarchy<T>::reaches(std::size_t from, std::size_t to) const noexcept
+{
+  if( from == to ) return true;
+  for( auto const& instance : this->definitions[from].instances )
+  {
+    if( this->reaches(instance.definition, to) ) return true;
+  }
+  return false;
+}
+
+template<typename T>
+std::optional<Bounds<T>> const& Hierarchy<T>::bounds_of(std::size_t definition) const noexcept
+{
+  if( this->stale || this->editing > 0 )
+  {
+    //
+    // Bounds of every definition, children first; a definition
+    // is only computed once however many instances it has
+    //
+    this->bounds.assign(this->definitions.size(), std::nullopt);
+    std::vector<bool> done(this->definitions.size(), false);
+
+    auto merge = [](std::optional<Bounds<T>>& into, std::optional<Bounds<T>> const& b)
+    {
+      if( ! b ) return;
+      if( ! into ) { into = b; return; }
+      into->first = { std::min(into->first.first, b->first.first),
+        std::min(into->first.second, b->first.second) };
+      into->second = { std::max(into->second.first, b->second.first),
+        std::max(into->second.second, b->second.second) };
+    };
+
+    std::function<void(std::size_t)> compute = [&](std::size_t d)
+    {
+      if( done[d] ) return;
+      auto const& def { this->definitions[d] };
+      std::optional<Bounds<T>> result;
+      merge(result, def.placements.get_bounds());
+      merge(result, def.wires.get_bounds());
+      for( auto const& instance : def.instances )
+      {
+        compute(instance.definition);
+        if( auto const& b {this->bounds[instance.definition]} )
+        {
+          merge(result, instance.transform.apply(*b));
+        }
+      }
+      this->bounds[d] = result;
+      done[d] = true;
+    };
+
+    for( std::size_t d{0}; d < this->definitions.size(); ++d ) compute(d);
+
+    //
+    // Grid of the instances of every definition, a bucket lists
+    // the instances whose box overlaps it in increasing order
+    //
+    this->grids.assign(this->definitions.size(), Grid{});
+    for( std::size_t d{0}; d < this->definitions.size(); ++d )
+    {
+      auto const& instances { this->definitions[d].instances };
+      auto& grid { this->grids[d] };
+
+      std::optional<Bounds<T>> extent;
+      std::vector<std::size_t> placed;
+      std::uint64_t sum_width {0};
+      std::uint64_t sum_height {0};
+      grid.boxes.resize(instances.size());
+      for( std::size_t i{0}; i < instances.size(); ++i )
+      {
+        auto const& b { this->bounds[instances[i].definition] };
+        if( ! b ) continue;
+        auto& box { grid.boxes[i] };
+        box = instances[i].transform.apply(*b);
+        merge(extent, box);
+        placed.push_back(i);
+        sum_width += static_cast<std::uint64_t>(box.second.first) - static_cast<std::uint64_t>(box.first.first);
+        sum_height += static_cast<std::uint64_t>(box.second.second) - static_cast<std::uint64_t>(box.first.second);
+      }
+      if( placed.empty() ) continue;
+
+      // About one bucket per instance, never smaller than the mean box
+      std::uint64_t side { static_cast<std::uint64_t>(std::ceil(std::sqrt(double(placed.size())))) };
+      auto span = [](T a, T b) { return static_cast<std::uint64_t>(b) - static_cast<std::uint64_t>(a); };
+      auto size = [&](std::uint64_t s, std::uint64_t sum)
+      {
+        return std::max({ s / side + 1, sum / placed.size() + 1, std::uint64_t{1} });
+      };
+      grid.origin = extent->first;
+      grid.width = size(span(extent->first.first, extent->second.first), sum_width);
+      grid.height = size(span(extent->first.second, extent->second.second), sum_height);
+      grid.columns = span(extent->first.first, extent->second.first) / grid.width + 1;
+      grid.rows = span(extent->first.second, extent->second.second) / grid.height + 1;
+
+      auto for_buckets = [&](Bounds<T> const& box, auto&& f)
+      {
+        auto c0 { span(grid.origin.first, box.first.first) / grid.width };
+        auto c1 { span(grid.origin.first, box.second.first) / grid.width };
+        auto r0 { span(grid.origin.second, box.first.second) / grid.height };
+        auto r1 { span(grid.origin.second, box.second.second) / grid.height };
+        for( auto r{r0}; r <= r1; ++r )
+          for( auto c{c0}; c <= c1; ++c ) f(r * grid.columns + c);
+      };
+
+      grid.offsets.assign(grid.columns * grid.rows + 1, 0);
+      for( auto i : placed ) for_buckets(grid.boxes[i], [&](std::size_t k) { ++grid.offsets[k+1]; });
+      for( std::size_t k{1}; k < grid.offsets.size(); ++k ) grid.offsets[k] += grid.offsets[k-1];
+
+      grid.members.resize(grid.offsets.back());
+      std::vector<std::size_t> fill(grid.offsets.cbegin(), grid.offsets.cend() - 1);
+      for( auto i : placed ) for_buckets(grid.boxes[i], [&](std::size_t k) { grid.members[fill[k]++] = i; });
+    }
+
+    this->stale = false;
+  }
+
+  return this->bounds[definition];
+}
+
+template<typename T>
+typename Hierarchy<T>::Grid const& Hierarchy<T>::grid_of(std::size_t definition) const noexcept
+{
+  // Brings the grids up to date with the bounds
+  this->bounds_of(definition);
+  return this->grids[definition];
+}
+
+template<typename T>
+std::optional<Hit<T>> Hierarchy<T>::at(std::size_t definition,
+  Cell<T> const& cell) const noexcept
+{
+  auto const& def { this->definitions[definition] };
+
+  if( auto id {def.placements.at(cell)} ) return Hit<T>{{}, *id};
+
+  auto const& grid { this->grid_of(definition) };
+  if( grid.members.empty() ) return std::nullopt;
+
+  if( cell.first < grid.origin.first || cell.second < grid.origin.second )
+    return std::nullopt;
+  auto column { (static_cast<std::uint64_t>(cell.first) - static_cast<std::uint64_t>(grid.origin.first)) / grid.width };
+  auto row { (static_cast<std::uint64_t>(cell.second) - static_cast<std::uint64_t>(grid.origin.second)) / grid.height };
+  if( column >= grid.columns || row >= grid.rows ) return std::nullopt;
+
+  // Members are in instance order, the first hit is the one a scan finds
+  auto bucket { row * grid.columns + column };
+  for( auto k{grid.offsets[bucket]}; k < grid.offsets[bucket+1]; ++k )
+  {
+    auto i { grid.members[k] };
+    auto const& box { grid.boxes[i] };
+    if( cell.first < box.first.first || cell.first > box.second.first ||
+        cell.second < box.first.second || cell.second > box.second.second )
+      continue;
+
+    auto const& instance { def.instances[i] };
+    if( auto hit {this->at(instance.definition, instance.transform.invert(cell))} )
+    {
+      hit->path.insert(hit->path.begin(), i);
+      return hit;
+    }
+  }
+
+  return std::nullopt;
+}
+
+template<typename T>
+template<typename F>
+void Hierarchy<T>::walk(std::size_t definition, Path& path,
+  std::vector<Transform<T>>& chain, F& f) const
+{
+  f(definition);
+
+  auto const& instances { this->definitions[definition].instances };
+  for( std::size_t i{0}; i < instances.size(); ++i )
+  {
+    path.push_back(i);
+    chain.push_back(instances[i].transform);
+    this->walk(instances[i].definition, path, chain, f);
+    chain.pop_back();
+    path.pop_back();
+  }
+}
+
+template<typename T>
+Cell<T> Hierarchy<T>::resolve(std::vector<Transform<T>> const& chain, Cell<T> cell) noexcept
+{
+  // The innermost transform is applied first
+  for( auto it{chain.crbegin()}; it != chain.crend(); ++it )
+  {
+    cell = it->apply(cell);
+  }
+  return cell;
+}
+
+} // namespace electra::hierarchy
@@ -0,0 +1,250 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : instrument
+// @created     : Tuesday Oct 27, 2026 15:21:07 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <memory>
+#include <cstdint>
+#include <memory_resource>
+
+#include <electra/arena.hpp>
+#include <nlohmann/json.hpp>
+
+#ifdef ELECTRA_INSTRUMENT
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace electra::instrument
+{
+
+#ifdef ELECTRA_INSTRUMENT
+inline constexpr bool enabled {true};
+#else
+inline constexpr bool enabled {false};
+#endif
+
+//
+// Counters of a container, every one of them stays at zero
+// unless ELECTRA_INSTRUMENT is defined
+//
+struct Stats
+{
+  // Public operations, and the cycles spent in them
+  std::uint64_t operations {0};
+  std::uint64_t cycles {0};
+  // Searches in trees, and wires visited by linear scans
+  std::uint64_t probes {0};
+  // Wires decoded, and the cells they held
+  std::uint64_t decodes {0};
+  std::uint64_t cells {0};
+  // Allocations taken from the memory resource, and their size
+  std::uint64_t allocations {0};
+  std::uint64_t bytes {0};
+};
+
+inline void to_json(nlohmann::json& j, Stats const& stats)
+{
+  j = nlohmann::json{
+    {"operations", stats.operations},
+    {"cycles", stats.cycles},
+    {"probes", stats.probes},
+    {"decodes", stats.decodes},
+    {"cells", stats.cells},
+    {"allocations", stats.allocations},
+    {"bytes", stats.bytes}};
+}
+
+//
+// Time stamp counter where available, nanoseconds otherwise
+//
+inline std::uint64_t cycles() noexcept
+{
+#ifdef ELECTRA_INSTRUMENT
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+#else
+  return 0;
+#endif
+}
+
+#ifdef ELECTRA_INSTRUMENT
+//
+// Memory resource counting the allocations forwarded to its
+// upstream, it holds the counters of its container
+//
+class Resource : public std::pmr::memory_resource
+{
+  private:
+  // Private Members
+    std::pmr::memory_resource* upstream;
+  public:
+  // Public Members
+    Stats stats;
+  // Constructors
+    explicit Resource(std::pmr::memory_resource* upstream) noexcept
+      : upstream(upstream)
+    {
+    }
+  private:
+  // Private Methods
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+      ++this->stats.allocations;
+      this->stats.bytes += bytes;
+      return this->upstream->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+      this->upstream->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+    {
+      return this == &other;
+    }
+};
+#endif
+
+//
+// Adds the cycles between its construction and destruction to
+// the counters, along with one operation
+//
+class Timer
+{
+  private:
+  // Private Members
+#ifdef ELECTRA_INSTRUMENT
+    Stats* stats;
+    std::uint64_t start;
+#endif
+  public:
+  // Constructors
+    explicit Timer([[maybe_unused]] Stats* stats) noexcept
+#ifdef ELECTRA_INSTRUMENT
+      : stats(stats)
+      , start(stats ? cycles() : 0)
+#endif
+    {
+    }
+    Timer(Timer const&) = delete;
+    Timer& operator=(Timer const&) = delete;
+    ~Timer()
+    {
+#ifdef ELECTRA_INSTRUMENT
+      if( ! this->stats ) return;
+      ++this->stats->operations;
+      this->stats->cycles += cycles() - this->start;
+#endif
+    }
+};
+
+//
+// Algorithm's Description:
+//   Handle to the counters of a container, kept as one of its
+//   members. With ELECTRA_INSTRUMENT defined it owns a counting
+//   memory resource, which the container allocates from; without
+//   it the handle is empty, and every method is an empty inline
+//   function the compiler drops.
+//
+// Cavefeats:
+//   Counters are not atomic, as the containers themselves. A
+//   container on an arena allocates from the arena directly, so
+//   that it is still released in O(1), and counts no
+//   allocations.
+//
+class Counters
+{
+  private:
+  // Private Members
+#ifdef ELECTRA_INSTRUMENT
+    std::shared_ptr<Resource> counting;
+#endif
+    std::pmr::memory_resource* upstream;
+  public:
+  // Constructors
+    explicit Counters(std::pmr::memory_resource* upstream
+      = std::pmr::get_default_resource()) noexcept;
+  // Public Methods
+    // Element Access
+    std::pmr::memory_resource* resource() const noexcept;
+    Stats get() const noexcept;
+    // Modifiers
+    void count(std::uint64_t Stats::* field, std::uint64_t n = 1) const noexcept;
+    Timer time() const noexcept;
+    void reset() const noexcept;
+};
+
+//
+// Constructors
+//
+inline Counters::Counters(std::pmr::memory_resource* upstream) noexcept
+  : upstream(upstream ? upstream : std::pmr::get_default_resource())
+{
+  //
+  // A null resource gives an empty handle, used by the
+  // iterators before they are bound to a container
+  //
+#ifdef ELECTRA_INSTRUMENT
+  if( upstream && ! dynamic_cast<arena::Arena*>(upstream) )
+  {
+    this->counting = std::make_shared<Resource>(upstream);
+  }
+#endif
+}
+
+//
+// Public Methods
+//
+inline std::pmr::memory_resource* Counters::resource() const noexcept
+{
+#ifdef ELECTRA_INSTRUMENT
+  if( this->counting ) return this->counting.get();
+#endif
+  return this->upstream;
+}
+
+inline Stats Counters::get() const noexcept
+{
+#ifdef ELECTRA_INSTRUMENT
+  if( this->counting ) return this->counting->stats;
+#endif
+  return {};
+}
+
+inline void Counters::count([[maybe_unused]] std::uint64_t Stats::* field,
+  [[maybe_unused]] std::uint64_t n) const noexcept
+{
+#ifdef ELECTRA_INSTRUMENT
+  if( this->counting ) this->counting->stats.*field += n;
+#endif
+}
+
+inline Timer Counters::time() const noexcept
+{
+#ifdef ELECTRA_INSTRUMENT
+  return Timer{this->counting ? &this->counting->stats : nullptr};
+#else
+  return Timer{nullptr};
+#endif
+}
+
+inline void Counters::reset() const noexcept
+{
+#ifdef ELECTRA_INSTRUMENT
+  if( this->counting ) this->counting->stats = {};
+#endif
+}
+
+} // namespace electra::instrument
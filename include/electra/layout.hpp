@@ -0,0 +1,424 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : layout
+// @created     : Sunday Oct 25, 2026 09:48:13 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <map>
+#include <vector>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <iterator>
+#include <optional>
+#include <algorithm>
+#include <type_traits>
+
+#include <electra/area.hpp>
+#include <electra/arena.hpp>
+#include <electra/memory.hpp>
+#include <electra/occupancy.hpp>
+#include <electra/point.hpp>
+#include <electra/timeline.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+
+namespace electra::layout
+{
+
+// Data types
+template<typename T>
+using Cell = std::pair<T,T>;
+template<typename T>
+using Endpoints = std::pair<Cell<T>,Cell<T>>;
+
+//
+// Algorithm's Description:
+//   Placements and wires over a single area, occupancy and id
+//   space. Both containers are attached to the same area and
+//   occupancy, so an edit updates the shared state once, and
+//   the bounding box of the layout is read directly. Wires are
+//   given ids from the same space as the placements, and are
+//   kept by id along with their handles, so wires sharing their
+//   endpoints are told apart.
+//   Batch operations detach the occupancy, and update it once
+//   at the end, with the cells of the whole batch ordered by
+//   their morton code; so each chunk is visited in a single
+//   run, appending to its sorted array.
+//
+// Cavefeats:
+//   The containers are only handed out as constant references,
+//   every edit must go through the layout.
+//
+template<typename T>
+class Layout
+{
+  private:
+  // Private Members
+    std::shared_ptr<area::Area<T>> area;
+    std::shared_ptr<occupancy::Occupancy<T>> occupancy;
+    placement::Placements<T> placements;
+    wire::Wires<T> wires;
+    std::pmr::map<T,wire::Handle> wire_ids;
+    T next;
+    std::vector<Cell<T>> scratch;
+  public:
+  // Constructors
+    explicit Layout(std::pmr::memory_resource* resource
+      = std::pmr::get_default_resource()) noexcept;
+  // Public Methods
+    // Element Access
+    std::optional<T> at(Cell<T> const& cell) const noexcept;
+    template<typename InIt, typename OutIt>
+    OutIt at(InIt it_beg, InIt it_end, OutIt out) const noexcept;
+    placement::Placements<T> const& get_placements() const noexcept;
+    wire::Wires<T> const& get_wires() const noexcept;
+    // Capacity
+    std::size_t size() const noexcept;
+    memory::Usage memory_usage() const noexcept;
+    // Modifiers
+    bool place(Cell<T> const& region, T id) noexcept;
+    template<typename U = std::vector<Cell<T>>>
+    std::optional<T> route(U&& cells) noexcept;
+    bool erase(T id) noexcept;
+    template<typename InIt>
+    std::size_t place(InIt it_beg, InIt it_end) noexcept;
+    template<typename InIt>
+    std::vector<T> route(InIt it_beg, InIt it_end) noexcept;
+    template<typename InIt>
+    std::size_t erase(InIt it_beg, InIt it_end) noexcept;
+    void shrink_to_fit() noexcept;
+    // Lookup
+    bool contains(T id) const noexcept;
+    std::optional<Cell<T>> find(T id) const noexcept;
+    std::optional<Endpoints<T>> find_wire(T id) const noexcept;
+    Cell<T> get_area() const noexcept;
+    std::optional<Endpoints<T>> get_bounds() const noexcept;
+    occupancy::Occupancy<T> const* get_occupancy() const noexcept;
+    // Operations
+    template<typename U = T, typename = std::enable_if_t<(sizeof(U) <= 4)>>
+    void enable_occupancy() noexcept;
+  private:
+  // Private Methods
+    // Modifiers
+    template<typename F>
+    void batch(F&& f, bool insert) noexcept;
+  public:
+  // Static Assertions
+    static_assert(std::is_integral<T>::value, "T must be of an integral type");
+    static_assert(std::is_signed<T>::value, "T must be of a signed type");
+};
+
+//
+// Constructors
+//
+template<typename T>
+Layout<T>::Layout(std::pmr::memory_resource* resource) noexcept
+  : area(arena::share<area::Area<T>>(resource))
+  , placements(resource)
+  , wires(resource)
+  , wire_ids(resource)
+  , next(0)
+{
+  this->placements.attach_area(this->area);
+  this->wires.attach_area(this->area);
+}
+
+//
+// Public Methods
+//
+template<typename T>
+std::optional<T> Layout<T>::at(Cell<T> const& cell) const noexcept
+{
+  return this->placements.at(cell);
+}
+
+template<typename T>
+template<typename InIt, typename OutIt>
+OutIt Layout<T>::at(InIt it_beg, InIt it_end, OutIt out) const noexcept
+{
+  return this->placements.at(it_beg, it_end, out);
+}
+
+template<typename T>
+placement::Placements<T> const& Layout<T>::get_placements() const noexcept
+{
+  return this->placements;
+}
+
+template<typename T>
+wire::Wires<T> const& Layout<T>::get_wires() const noexcept
+{
+  return this->wires;
+}
+
+template<typename T>
+std::size_t Layout<T>::size() const noexcept
+{
+  return this->placements.size() + this->wire_ids.size();
+}
+
+template<typename T>
+memory::Usage Layout<T>::memory_usage() const noexcept
+{
+  auto resource { this->wire_ids.get_allocator().resource() };
+
+  auto usage { this->placements.memory_usage() };
+  usage += this->wires.memory_usage();
+  usage += memory::map(this->wire_ids);
+
+  auto scratch { memory::vector(this->scratch) };
+  scratch.slack += scratch.payload;
+  scratch.payload = 0;
+  usage += scratch;
+
+  //
+  // Both containers count the area and occupancy they share,
+  // one of the copies is taken out
+  //
+  usage -= memory::shared<area::Area<T>>(resource);
+  usage -= this->area->memory_usage();
+  if( this->occupancy )
+  {
+    usage -= memory::shared<occupancy::Occupancy<T>>();
+    usage -= this->occupancy->memory_usage();
+  }
+
+  return usage;
+}
+
+template<typename T>
+bool Layout<T>::place(Cell<T> const& region, T id) noexcept
+{
+  if( this->contains(id) ) return false;
+
+  this->placements.insert(std::make_pair(region, id));
+  this->next = std::max<T>(this->next, id + 1);
+
+  return true;
+}
+
+template<typename T>
+template<typename U>
+std::optional<T> Layout<T>::route(U&& cells) noexcept
+{
+  if( std::cbegin(cells) == std::cend(cells) ) return std::nullopt;
+
+  auto handle { this->wires.insert(std::forward<U>(cells)) };
+
+  // Ids only grow, so each one is inserted at the end
+  this->wire_ids.emplace_hint(this->wire_ids.end(), this->next, handle);
+
+  return this->next++;
+}
+
+template<typename T>
+bool Layout<T>::erase(T id) noexcept
+{
+  if( this->placements.find(id) )
+  {
+    this->placements.erase(id);
+    return true;
+  }
+
+  auto search { this->wire_ids.find(id) };
+  if( search == this->wire_ids.end() ) return false;
+
+  this->wires.erase(search->second);
+  this->wire_ids.erase(search);
+
+  return true;
+}
+
+template<typename T>
+template<typename InIt>
+std::size_t Layout<T>::place(InIt it_beg, InIt it_end) noexcept
+{
+  //
+  // Each element is a region and an id, the ones whose id
+  // is taken are skipped
+  //
+  std::size_t count {0};
+
+  this->batch([&]
+  {
+    for( auto it{it_beg}; it != it_end; ++it )
+    {
+      if( ! this->place(it->first, it->second) ) continue;
+      this->scratch.push_back(it->first);
+      ++count;
+    }
+  }, true);
+
+  return count;
+}
+
+template<typename T>
+template<typename InIt>
+std::vector<T> Layout<T>::route(InIt it_beg, InIt it_end) noexcept
+{
+  std::vector<T> ids;
+  ids.reserve(static_cast<std::size_t>(std::distance(it_beg, it_end)));
+
+  this->batch([&]
+  {
+    for( auto it{it_beg}; it != it_end; ++it )
+    {
+      //
+      // The cells are gathered before the wire takes them,
+      // a move iterator leaves them empty afterwards
+      //
+      this->scratch.insert(this->scratch.end(), std::cbegin(*it), std::cend(*it));
+      if( auto id {this->route(*it)} ) ids.push_back(*id);
+    }
+  }, true);
+
+  return ids;
+}
+
+template<typename T>
+template<typename InIt>
+std::size_t Layout<T>::erase(InIt it_beg, InIt it_end) noexcept
+{
+  std::size_t count {0};
+
+  this->batch([&]
+  {
+    for( auto it{it_beg}; it != it_end; ++it )
+    {
+      //
+      // The cells are gathered before they are released
+      //
+      if( auto region {this->placements.find(*it)} )
+      {
+        this->scratch.push_back(*region);
+      }
+      else if( auto search {this->wire_ids.find(*it)}; search != this->wire_ids.end() )
+      {
+        if( auto wire {this->wires.find(search->second)} )
+        {
+          // Each dereference decodes the wire again, in the same buffer
+          auto const& cells { **wire };
+          this->scratch.insert(this->scratch.end(), cells.cbegin(), cells.cend());
+        }
+      }
+
+      if( this->erase(*it) ) ++count;
+    }
+  }, false);
+
+  return count;
+}
+
+template<typename T>
+void Layout<T>::shrink_to_fit() noexcept
+{
+  this->placements.shrink_to_fit();
+  this->wires.shrink_to_fit();
+  this->scratch.clear();
+  this->scratch.shrink_to_fit();
+}
+
+template<typename T>
+bool Layout<T>::contains(T id) const noexcept
+{
+  return this->placements.find(id) || this->wire_ids.count(id);
+}
+
+template<typename T>
+std::optional<Cell<T>> Layout<T>::find(T id) const noexcept
+{
+  return this->placements.find(id);
+}
+
+template<typename T>
+std::optional<Endpoints<T>> Layout<T>::find_wire(T id) const noexcept
+{
+  auto search { this->wire_ids.find(id) };
+  if( search == this->wire_ids.cend() ) return std::nullopt;
+
+  auto wire { this->wires.find(search->second) };
+  if( ! wire ) return std::nullopt;
+
+  auto const& cells { **wire };
+  return Endpoints<T>{cells.front(), cells.back()};
+}
+
+template<typename T>
+Cell<T> Layout<T>::get_area() const noexcept
+{
+  return this->area->get_area();
+}
+
+template<typename T>
+std::optional<Endpoints<T>> Layout<T>::get_bounds() const noexcept
+{
+  return this->area->get_bounds();
+}
+
+template<typename T>
+occupancy::Occupancy<T> const* Layout<T>::get_occupancy() const noexcept
+{
+  return this->occupancy.get();
+}
+
+//
+// Operations
+//
+template<typename T>
+template<typename U, typename>
+void Layout<T>::enable_occupancy() noexcept
+{
+  timeline::Scope scope {"layout.enable_occupancy"};
+  //
+  // A single occupancy, filled with the cells of both
+  // containers and attached to them
+  //
+  this->occupancy = std::make_shared<occupancy::Occupancy<T>>();
+
+  for( auto it{this->placements.cbegin()}; it != this->placements.cend(); ++it )
+  {
+    this->occupancy->insert({it->first});
+  }
+
+  for( auto it{this->wires.cbegin()}; it != this->wires.cend(); ++it )
+  {
+    this->occupancy->insert(*it);
+  }
+
+  this->placements.attach_occupancy(this->occupancy);
+  this->wires.attach_occupancy(this->occupancy);
+}
+
+//
+// Private Methods
+//
+template<typename T>
+template<typename F>
+void Layout<T>::batch(F&& f, bool insert) noexcept
+{
+  timeline::Scope scope {"layout.batch"};
+  this->scratch.clear();
+
+  if( ! this->occupancy ) { f(); return; }
+
+  this->placements.attach_occupancy(nullptr);
+  this->wires.attach_occupancy(nullptr);
+
+  f();
+
+  point::sort(this->scratch.begin(), this->scratch.end(), point::Morton{});
+
+  if( insert ) this->occupancy->insert(this->scratch);
+  else this->occupancy->erase(this->scratch);
+
+  this->placements.attach_occupancy(this->occupancy);
+  this->wires.attach_occupancy(this->occupancy);
+}
+
+} // namespace electra::layout
@@ -0,0 +1,371 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : legalize
+// @created     : Tuesday Oct 20, 2026 14:20:57 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cmath>
+#include <tuple>
+#include <numeric>
+#include <optional>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+
+#include <electra/executor.hpp>
+#include <electra/placements.hpp>
+
+namespace electra::legalize
+{
+
+// Data types
+struct Options
+{
+  // Rows are split in this many bands, each one legalized
+  // as a task of the executor; one means a single band
+  std::size_t threads {1};
+};
+
+struct Report
+{
+  bool legal {false};
+  std::size_t moved {0};
+  std::uint64_t total_displacement {0};
+  std::uint64_t max_displacement {0};
+};
+
+//
+// Algorithm's Description:
+//   Abacus legalization for cells of a single site. Cells are
+//   swept in order of their x coordinate; each one is tried in
+//   the rows around its own, closest first, and placed where it
+//   moves the least. Inside a row, cells that would overlap
+//   are merged into clusters placed at the position that
+//   minimizes the displacement of their cells, which may push
+//   the previous clusters and merge them as well.
+//
+template<typename T>
+class Abacus
+{
+  public:
+  // Public Types
+    struct Cell
+    {
+      T id;
+      T x;
+      T y;
+    };
+  private:
+  // Private Types
+    struct Cluster
+    {
+      double e;
+      double q;
+      std::size_t first;
+      std::size_t n;
+      T x;
+    };
+    struct Row
+    {
+      std::vector<std::size_t> cells;
+      std::vector<Cluster> clusters;
+    };
+  // Private Members
+    T x0;
+    T x1;
+    T y0;
+    std::vector<Cell> const& cells;
+    std::vector<Row> rows;
+  public:
+  // Constructors
+    Abacus(std::pair<T,T> const& a, std::pair<T,T> const& b,
+      std::vector<Cell> const& cells) noexcept;
+  // Public Methods
+    // Operations
+    template<typename InIt>
+    bool place(InIt&& it_beg, InIt&& it_end) noexcept;
+    template<typename OutIt>
+    void positions(OutIt&& out) const noexcept;
+  private:
+  // Private Methods
+    // Lookup
+    std::optional<T> trial(Row const& row, double x) const noexcept;
+    T optimal(Cluster const& cluster) const noexcept;
+    // Modifiers
+    void commit(Row& row, std::size_t cell) noexcept;
+};
+
+//
+// Constructors
+//
+template<typename T>
+Abacus<T>::Abacus(std::pair<T,T> const& a, std::pair<T,T> const& b,
+  std::vector<Cell> const& cells) noexcept
+  : x0(std::min(a.first, b.first))
+  , x1(std::max(a.first, b.first))
+  , y0(std::min(a.second, b.second))
+  , cells(cells)
+  , rows(static_cast<std::size_t>(std::max(a.second, b.second) - y0) + 1)
+{
+}
+
+//
+// Public Methods
+//
+template<typename T>
+template<typename InIt>
+bool Abacus<T>::place(InIt&& it_beg, InIt&& it_end) noexcept
+{
+  //
+  // Cells are expected sorted by their x coordinate
+  //
+  for( auto it{it_beg}; it != it_end; ++it )
+  {
+    auto const& cell { this->cells[*it] };
+
+    auto y_max { static_cast<T>(this->y0 + static_cast<T>(this->rows.size()) - 1) };
+    auto r0 { static_cast<std::size_t>(std::clamp(cell.y, this->y0, y_max) - this->y0) };
+
+    double best { std::numeric_limits<double>::max() };
+    std::optional<std::size_t> chosen;
+
+    auto attempt = [&](std::size_t r)
+    {
+      auto dy { std::abs(static_cast<double>(this->y0) + r - cell.y) };
+      if( dy >= best ) return;
+      auto x { this->trial(this->rows[r], cell.x) };
+      if( ! x ) return;
+      auto cost { dy + std::abs(static_cast<double>(*x) - cell.x) };
+      if( cost < best ) { best = cost; chosen = r; }
+    };
+
+    //
+    // Rows further than the best cost so far cannot improve it
+    //
+    for( std::size_t k{0}; ; ++k )
+    {
+      auto up { r0 >= k };
+      auto down { r0 + k < this->rows.size() };
+      if( ! up && ! down ) break;
+
+      if( static_cast<double>(k) >= best ) break;
+
+      if( up ) attempt(r0 - k);
+      if( down && k != 0 ) attempt(r0 + k);
+    }
+
+    if( ! chosen ) return false;
+
+    this->commit(this->rows[*chosen], *it);
+  }
+
+  return true;
+}
+
+template<typename T>
+template<typename OutIt>
+void Abacus<T>::positions(OutIt&& out) const noexcept
+{
+  for( std::size_t r{0}; r < this->rows.size(); ++r )
+  {
+    auto const& row { this->rows[r] };
+    for( auto const& cluster : row.clusters )
+    {
+      for( std::size_t k{0}; k < cluster.n; ++k )
+      {
+        auto const& cell { this->cells[row.cells[cluster.first+k]] };
+        *out = std::make_pair(std::make_pair(static_cast<T>(cluster.x + static_cast<T>(k)),
+          static_cast<T>(this->y0 + static_cast<T>(r))), cell.id);
+        ++out;
+      }
+    }
+  }
+}
+
+//
+// Private Methods
+//
+template<typename T>
+std::optional<T> Abacus<T>::trial(Row const& row, double x) const noexcept
+{
+  auto width { static_cast<std::size_t>(this->x1 - this->x0) + 1 };
+  if( row.cells.size() >= width ) return std::nullopt;
+
+  //
+  // Collapse a single cell cluster against the last clusters
+  // of the row, without changing them
+  //
+  Cluster cluster { 1, x, row.cells.size(), 1, 0 };
+  cluster.x = this->optimal(cluster);
+
+  for( auto it{row.clusters.rbegin()}; it != row.clusters.rend(); ++it )
+  {
+    if( it->x + static_cast<T>(it->n) <= cluster.x ) break;
+    Cluster merged { it->e + cluster.e, it->q + cluster.q - cluster.e*it->n,
+      it->first, it->n + cluster.n, 0 };
+    merged.x = this->optimal(merged);
+    cluster = merged;
+  }
+
+  return static_cast<T>(cluster.x + static_cast<T>(cluster.n) - 1);
+}
+
+template<typename T>
+T Abacus<T>::optimal(Cluster const& cluster) const noexcept
+{
+  auto x { static_cast<T>(std::lround(cluster.q / cluster.e)) };
+  auto x_max { static_cast<T>(this->x1 - static_cast<T>(cluster.n) + 1) };
+  return std::clamp(x, this->x0, x_max);
+}
+
+template<typename T>
+void Abacus<T>::commit(Row& row, std::size_t cell) noexcept
+{
+  Cluster cluster { 1, static_cast<double>(this->cells[cell].x), row.cells.size(), 1, 0 };
+  cluster.x = this->optimal(cluster);
+  row.cells.push_back(cell);
+
+  while( ! row.clusters.empty() )
+  {
+    auto& last { row.clusters.back() };
+    if( last.x + static_cast<T>(last.n) <= cluster.x ) break;
+    Cluster merged { last.e + cluster.e, last.q + cluster.q - cluster.e*last.n,
+      last.first, last.n + cluster.n, 0 };
+    merged.x = this->optimal(merged);
+    cluster = merged;
+    row.clusters.pop_back();
+  }
+
+  row.clusters.push_back(cluster);
+}
+
+//
+// Legalizes every placement into the inclusive region with
+// corners a and b, one placement per cell, moving them as
+// little as possible. Placements are left untouched when the
+// region is too small to hold them
+//
+template<typename T>
+Report legalize(placement::Placements<T>& placements,
+  std::pair<T,T> const& a, std::pair<T,T> const& b,
+  Options const& options = {},
+  executor::Executor* executor = executor::get_default()) noexcept
+{
+  using Cell = typename Abacus<T>::Cell;
+  using Entry = std::pair<std::pair<T,T>,T>;
+
+  Report report;
+
+  auto width { static_cast<std::size_t>(std::abs(b.first - a.first)) + 1 };
+  auto height { static_cast<std::size_t>(std::abs(b.second - a.second)) + 1 };
+  auto y0 { std::min(a.second, b.second) };
+
+  std::vector<Cell> cells;
+  cells.reserve(placements.size());
+  for( auto it{placements.id_cbegin()}; it != placements.id_cend(); ++it )
+  {
+    cells.push_back({it->first, it->second.first, it->second.second});
+  }
+
+  if( cells.size() > width*height ) return report;
+
+  //
+  // Sorted sweep on the x coordinate
+  //
+  std::vector<std::size_t> order(cells.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](auto l, auto r)
+  {
+    return std::tie(cells[l].x, cells[l].y) < std::tie(cells[r].x, cells[r].y);
+  });
+
+  std::vector<Entry> entries;
+  entries.reserve(cells.size());
+
+  //
+  // Row bands are independent when each one holds its cells,
+  // else the whole region is legalized at once
+  //
+  auto bands { std::clamp<std::size_t>(options.threads, 1, height) };
+  std::vector<std::vector<std::size_t>> members(bands);
+
+  for( auto i : order )
+  {
+    auto r { static_cast<std::size_t>(std::clamp(cells[i].y, y0,
+      static_cast<T>(y0 + static_cast<T>(height) - 1)) - y0) };
+    members[r * bands / height].push_back(i);
+  }
+
+  auto band_first = [&](std::size_t k) { return (k*height + bands - 1) / bands; };
+
+  for( std::size_t k{0}; k < bands && bands > 1; ++k )
+  {
+    if( members[k].size() > (band_first(k+1) - band_first(k))*width ) bands = 1;
+  }
+
+  if( bands == 1 )
+  {
+    Abacus<T> abacus(a, b, cells);
+    if( ! abacus.place(order.cbegin(), order.cend()) ) return report;
+    abacus.positions(std::back_inserter(entries));
+  }
+  else
+  {
+    auto x0 { std::min(a.first, b.first) };
+    auto x1 { std::max(a.first, b.first) };
+
+    std::vector<std::vector<Entry>> results(bands);
+    std::vector<char> placed(bands, 0);
+
+    // A band per chunk, each writes its own result
+    executor::for_each(executor, bands, 1, [&](std::size_t beg, std::size_t end)
+    {
+      for( auto k{beg}; k < end; ++k )
+      {
+        Abacus<T> abacus({x0, static_cast<T>(y0 + static_cast<T>(band_first(k)))},
+          {x1, static_cast<T>(y0 + static_cast<T>(band_first(k+1)) - 1)}, cells);
+        placed[k] = abacus.place(members[k].cbegin(), members[k].cend());
+        abacus.positions(std::back_inserter(results[k]));
+      }
+    });
+
+    if( std::count(placed.cbegin(), placed.cend(), 0) ) return report;
+
+    for( auto& result : results )
+    {
+      entries.insert(entries.end(), result.cbegin(), result.cend());
+    }
+  }
+
+  //
+  // Apply the displaced placements as a single batch of moves,
+  // placements which stay in a region they do not own, as it
+  // was shared, are moved in place to take it over
+  //
+  auto kept { std::remove_if(entries.begin(), entries.end(), [&](auto const& entry)
+  {
+    auto current { *placements.find(entry.second) };
+    auto d { static_cast<std::uint64_t>(std::abs(current.first - entry.first.first))
+      + static_cast<std::uint64_t>(std::abs(current.second - entry.first.second)) };
+    report.total_displacement += d;
+    report.max_displacement = std::max(report.max_displacement, d);
+    report.moved += d != 0;
+    return d == 0 && placements.at(current) == entry.second;
+  }) };
+  entries.erase(kept, entries.end());
+
+  placements.move(entries.cbegin(), entries.cend());
+
+  report.legal = true;
+  return report;
+}
+
+} // namespace electra::legalize
@@ -0,0 +1,191 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : memory
+// @created     : Thursday Oct 29, 2026 10:14:52 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <memory>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+#include <memory_resource>
+
+#include <electra/arena.hpp>
+#include <nlohmann/json.hpp>
+
+namespace electra::memory
+{
+
+//
+// Heap memory held by a container, in bytes. The container
+// object itself, which may live on the stack, is not counted
+//
+struct Usage
+{
+  // Cells, ids and counts stored by the container
+  std::size_t payload {0};
+  // Tree nodes, vector headers, keys and the objects reached
+  // through pointers, which organize the payload
+  std::size_t index {0};
+  // Capacity reserved but not in use
+  std::size_t slack {0};
+  // Estimated bookkeeping of the allocator, see overhead()
+  std::size_t allocator {0};
+
+  std::size_t total() const noexcept
+  {
+    return this->payload + this->index + this->slack + this->allocator;
+  }
+
+  Usage& operator+=(Usage const& rhs) noexcept
+  {
+    this->payload += rhs.payload;
+    this->index += rhs.index;
+    this->slack += rhs.slack;
+    this->allocator += rhs.allocator;
+    return *this;
+  }
+
+  Usage& operator-=(Usage const& rhs) noexcept
+  {
+    this->payload -= rhs.payload;
+    this->index -= rhs.index;
+    this->slack -= rhs.slack;
+    this->allocator -= rhs.allocator;
+    return *this;
+  }
+};
+
+inline void to_json(nlohmann::json& j, Usage const& usage)
+{
+  j = nlohmann::json{
+    {"payload", usage.payload},
+    {"index", usage.index},
+    {"slack", usage.slack},
+    {"allocator", usage.allocator},
+    {"total", usage.total()}};
+}
+
+// Links, color and parent of a node of std::map
+inline constexpr std::size_t NODE {4 * sizeof(void*)};
+// Counts, deleter and allocator of a shared_ptr control block
+inline constexpr std::size_t CONTROL {4 * sizeof(void*)};
+
+//
+// Bytes kept by the allocator around a block, modelled after
+// malloc: a size header, blocks rounded to twice the pointer
+// size and a minimum block of four pointers. Arenas keep no
+// header, and their padding is not counted.
+//
+inline std::size_t overhead(std::size_t bytes,
+  std::pmr::memory_resource* resource = nullptr) noexcept
+{
+  if( dynamic_cast<arena::Arena*>(resource) ) return 0;
+
+  constexpr std::size_t align { 2 * sizeof(void*) };
+  auto block { (bytes + sizeof(std::size_t) + align - 1) / align * align };
+  return std::max(block, 4 * sizeof(void*)) - bytes;
+}
+
+//
+// Resource of an allocator, null for the ones which are not
+// polymorphic, these are assumed to use malloc
+//
+template<typename A>
+std::pmr::memory_resource* resource([[maybe_unused]] A const& allocator) noexcept
+{
+  if constexpr ( std::is_convertible_v<A, std::pmr::polymorphic_allocator<std::byte>> )
+  {
+    return allocator.resource();
+  }
+  else
+  {
+    return nullptr;
+  }
+}
+
+//
+// Elements of a contiguous container are payload, the unused
+// capacity is slack; the buffer is a single allocation
+//
+template<typename V>
+Usage vector(V const& v) noexcept
+{
+  using Value = typename V::value_type;
+
+  Usage usage;
+  usage.payload = v.size() * sizeof(Value);
+  usage.slack = (v.capacity() - v.size()) * sizeof(Value);
+  if( v.capacity() > 0 )
+  {
+    usage.allocator = overhead(v.capacity() * sizeof(Value), resource(v.get_allocator()));
+  }
+  return usage;
+}
+
+//
+// Each entry of a tree is a node of its own, holding the entry
+// and the links of the node
+//
+template<typename M>
+Usage map(M const& m) noexcept
+{
+  using Value = typename M::value_type;
+
+  Usage usage;
+  usage.payload = m.size() * sizeof(Value);
+  usage.index = m.size() * NODE;
+  usage.allocator = m.size() * overhead(NODE + sizeof(Value), resource(m.get_allocator()));
+  return usage;
+}
+
+//
+// Each entry of a hash table is a node linked to the next one,
+// the buckets are a single array of pointers, unless there is
+// only one bucket, which is kept in the table itself
+//
+template<typename M>
+Usage hash(M const& m) noexcept
+{
+  using Value = typename M::value_type;
+
+  Usage usage;
+  usage.payload = m.size() * sizeof(Value);
+  usage.index = m.size() * sizeof(void*);
+  usage.allocator = m.size() * overhead(sizeof(void*) + sizeof(Value), resource(m.get_allocator()));
+  if( m.bucket_count() > 1 )
+  {
+    usage.index += m.bucket_count() * sizeof(void*);
+    usage.allocator += overhead(m.bucket_count() * sizeof(void*), resource(m.get_allocator()));
+  }
+  return usage;
+}
+
+//
+// An object reached through a pointer, its members are part of
+// the index; shared objects carry a control block as well
+//
+template<typename U>
+Usage object(std::pmr::memory_resource* resource = nullptr) noexcept
+{
+  Usage usage;
+  usage.index = sizeof(U);
+  usage.allocator = overhead(sizeof(U), resource);
+  return usage;
+}
+
+template<typename U>
+Usage shared(std::pmr::memory_resource* resource = nullptr) noexcept
+{
+  auto usage { object<U>(resource) };
+  usage.index += CONTROL;
+  usage.allocator += overhead(CONTROL, resource);
+  return usage;
+}
+
+} // namespace electra::memory
@@ -0,0 +1,735 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : occupancy
+// @created     : Monday Oct 19, 2026 13:40:52 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+#include <unordered_map>
+#include <type_traits>
+
+#include <electra/memory.hpp>
+#include <electra/point.hpp>
+
+namespace electra::occupancy
+{
+
+// Data types
+using Code = std::uint64_t;
+using Key = std::uint64_t;
+using Low = std::uint16_t;
+
+// Container limits
+constexpr std::size_t ARRAY_MAX { 4096 };
+constexpr std::size_t WORDS { 1024 };
+constexpr std::uint32_t CELLS { 65536 };
+
+//
+// Morton codes, see point.hpp
+//
+using point::spread;
+using point::compact;
+using point::bias;
+using point::unbias;
+
+template<typename T>
+Code encode(std::pair<T,T> const& a) noexcept
+{
+  return point::morton(a);
+}
+
+template<typename T>
+std::pair<T,T> decode(Code c) noexcept
+{
+  return point::from_morton<T>(c);
+}
+
+inline std::uint32_t popcount(std::uint64_t w) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::uint32_t>(__builtin_popcountll(w));
+#else
+  std::uint32_t n{0};
+  for( ; w; w &= w-1 ) ++n;
+  return n;
+#endif
+}
+
+inline std::uint32_t countr_zero(std::uint64_t w) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::uint32_t>(__builtin_ctzll(w));
+#else
+  std::uint32_t n{0};
+  for( ; !(w & 1); w >>= 1 ) ++n;
+  return n;
+#endif
+}
+
+inline std::uint32_t countl_zero(std::uint64_t w) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::uint32_t>(__builtin_clzll(w));
+#else
+  std::uint32_t n{0};
+  for( ; !(w >> 63); w <<= 1 ) ++n;
+  return n;
+#endif
+}
+
+//
+// Container of the 65536 cells which share the 48 high bits
+// of their morton code, a 256x256 tile of the grid. Sparse
+// tiles keep a sorted array, dense ones a bitmap and tiles
+// with every cell set keep nothing at all
+//
+enum class Kind
+{
+  ARRAY,
+  BITMAP,
+  FULL,
+};
+
+struct Chunk
+{
+  // Public Members
+    Kind kind {Kind::ARRAY};
+    std::uint32_t cardinality {0};
+    std::vector<Low> array;
+    std::vector<std::uint64_t> bitmap;
+  // Public Methods
+    // Lookup
+    bool contains(Low low) const noexcept;
+    template<typename F>
+    void for_each(F&& f) const;
+    // Modifiers
+    bool add(Low low) noexcept;
+    bool remove(Low low) noexcept;
+    void to_bitmap() noexcept;
+    void normalize() noexcept;
+    // Operations
+    void unite(Chunk const& rhs) noexcept;
+    void intersect(Chunk const& rhs) noexcept;
+    void subtract(Chunk const& rhs) noexcept;
+};
+
+inline bool Chunk::contains(Low low) const noexcept
+{
+  switch (this->kind)
+  {
+    case Kind::ARRAY:
+      return std::binary_search(this->array.cbegin(), this->array.cend(), low);
+    case Kind::BITMAP:
+      return (this->bitmap[low >> 6] >> (low & 63)) & 1;
+    default:
+      return true;
+  }
+}
+
+template<typename F>
+void Chunk::for_each(F&& f) const
+{
+  switch (this->kind)
+  {
+    case Kind::ARRAY:
+      for( auto low : this->array ) f(low);
+      break;
+    case Kind::BITMAP:
+      for( std::size_t i{0}; i < WORDS; ++i )
+      {
+        for( auto w{this->bitmap[i]}; w; w &= w-1 )
+        {
+          f(static_cast<Low>((i << 6) | countr_zero(w)));
+        }
+      }
+      break;
+    default:
+      for( std::uint32_t low{0}; low < CELLS; ++low ) f(static_cast<Low>(low));
+  }
+}
+
+inline bool Chunk::add(Low low) noexcept
+{
+  switch (this->kind)
+  {
+    case Kind::ARRAY:
+    {
+      auto it { std::lower_bound(this->array.begin(), this->array.end(), low) };
+      if( it != this->array.end() && *it == low ) return false;
+      this->array.insert(it, low);
+      ++this->cardinality;
+      if( this->cardinality > ARRAY_MAX ) this->to_bitmap();
+      return true;
+    }
+    case Kind::BITMAP:
+    {
+      auto& w { this->bitmap[low >> 6] };
+      auto bit { std::uint64_t{1} << (low & 63) };
+      if( w & bit ) return false;
+      w |= bit;
+      if( ++this->cardinality == CELLS ) this->normalize();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+inline bool Chunk::remove(Low low) noexcept
+{
+  if( this->kind == Kind::FULL ) this->to_bitmap();
+
+  if( this->kind == Kind::ARRAY )
+  {
+    auto it { std::lower_bound(this->array.begin(), this->array.end(), low) };
+    if( it == this->array.end() || *it != low ) return false;
+    this->array.erase(it);
+    --this->cardinality;
+    return true;
+  }
+
+  auto& w { this->bitmap[low >> 6] };
+  auto bit { std::uint64_t{1} << (low & 63) };
+  if( !(w & bit) ) return false;
+  w &= ~bit;
+  // Half the limit, so chunks at the limit do not flip back and forth
+  if( --this->cardinality <= ARRAY_MAX / 2 ) this->normalize();
+  return true;
+}
+
+inline void Chunk::to_bitmap() noexcept
+{
+  if( this->kind == Kind::BITMAP ) return;
+
+  if( this->kind == Kind::FULL )
+  {
+    this->bitmap.assign(WORDS, ~std::uint64_t{0});
+  }
+  else
+  {
+    this->bitmap.assign(WORDS, 0);
+    for( auto low : this->array ) this->bitmap[low >> 6] |= std::uint64_t{1} << (low & 63);
+    this->array = {};
+  }
+
+  this->kind = Kind::BITMAP;
+}
+
+inline void Chunk::normalize() noexcept
+{
+  //
+  // Pick the smallest representation for the cardinality,
+  // bitmaps only go back to arrays at half their limit
+  //
+  if( this->kind == Kind::ARRAY || this->kind == Kind::FULL ) return;
+
+  if( this->cardinality == CELLS )
+  {
+    this->bitmap = {};
+    this->kind = Kind::FULL;
+  }
+  else if( this->cardinality <= ARRAY_MAX / 2 )
+  {
+    this->array.clear();
+    this->array.reserve(this->cardinality);
+    this->for_each([&](Low low){ this->array.push_back(low); });
+    this->bitmap = {};
+    this->kind = Kind::ARRAY;
+  }
+}
+
+inline void Chunk::unite(Chunk const& rhs) noexcept
+{
+  if( this->kind == Kind::FULL ) return;
+  if( rhs.kind == Kind::FULL ) { *this = rhs; return; }
+
+  if( this->kind == Kind::ARRAY && rhs.kind == Kind::ARRAY
+    && this->cardinality + rhs.cardinality <= ARRAY_MAX )
+  {
+    std::vector<Low> merged;
+    merged.reserve(this->cardinality + rhs.cardinality);
+    std::set_union(this->array.cbegin(), this->array.cend(),
+      rhs.array.cbegin(), rhs.array.cend(), std::back_inserter(merged));
+    this->array = std::move(merged);
+    this->cardinality = static_cast<std::uint32_t>(this->array.size());
+    return;
+  }
+
+  this->to_bitmap();
+
+  if( rhs.kind == Kind::ARRAY )
+  {
+    for( auto low : rhs.array ) this->bitmap[low >> 6] |= std::uint64_t{1} << (low & 63);
+  }
+  else
+  {
+    for( std::size_t i{0}; i < WORDS; ++i ) this->bitmap[i] |= rhs.bitmap[i];
+  }
+
+  this->cardinality = 0;
+  for( auto w : this->bitmap ) this->cardinality += popcount(w);
+  this->normalize();
+}
+
+inline void Chunk::intersect(Chunk const& rhs) noexcept
+{
+  if( rhs.kind == Kind::FULL ) return;
+  if( this->kind == Kind::FULL ) { *this = rhs; return; }
+
+  //
+  // The result is never larger than the smallest operand, an
+  // array operand yields an array
+  //
+  if( this->kind == Kind::ARRAY || rhs.kind == Kind::ARRAY )
+  {
+    auto const& small { this->kind == Kind::ARRAY ? *this : rhs };
+    auto const& other { this->kind == Kind::ARRAY ? rhs : *this };
+    std::vector<Low> kept;
+    kept.reserve(small.cardinality);
+    for( auto low : small.array ) if( other.contains(low) ) kept.push_back(low);
+    this->array = std::move(kept);
+    this->bitmap = {};
+    this->kind = Kind::ARRAY;
+    this->cardinality = static_cast<std::uint32_t>(this->array.size());
+    return;
+  }
+
+  this->cardinality = 0;
+  for( std::size_t i{0}; i < WORDS; ++i )
+  {
+    this->bitmap[i] &= rhs.bitmap[i];
+    this->cardinality += popcount(this->bitmap[i]);
+  }
+  this->normalize();
+}
+
+inline void Chunk::subtract(Chunk const& rhs) noexcept
+{
+  if( rhs.kind == Kind::FULL ) { *this = Chunk{}; return; }
+
+  if( this->kind == Kind::ARRAY )
+  {
+    auto end { std::remove_if(this->array.begin(), this->array.end(),
+      [&](Low low){ return rhs.contains(low); }) };
+    this->array.erase(end, this->array.end());
+    this->cardinality = static_cast<std::uint32_t>(this->array.size());
+    return;
+  }
+
+  this->to_bitmap();
+
+  if( rhs.kind == Kind::ARRAY )
+  {
+    for( auto low : rhs.array ) this->bitmap[low >> 6] &= ~(std::uint64_t{1} << (low & 63));
+  }
+  else
+  {
+    for( std::size_t i{0}; i < WORDS; ++i ) this->bitmap[i] &= ~rhs.bitmap[i];
+  }
+
+  this->cardinality = 0;
+  for( auto w : this->bitmap ) this->cardinality += popcount(w);
+  this->normalize();
+}
+
+//
+// Algorithm's Description:
+//   Compressed occupancy of a sparse grid. Cells are ordered
+//   by their morton code and grouped in 256x256 tiles, each
+//   one a Chunk; tiles without cells take no memory. Cells
+//   occupied more than once, e.g. crossing wires, have their
+//   extra occupants counted aside so that erasing one of
+//   them keeps the cell set.
+// Cavefeats:
+//   Set operations treat both operands as sets of cells,
+//   the extra occupants are dropped from the result
+//
+template<typename T>
+class Occupancy
+{
+  private:
+  // Private Members
+    std::vector<Key> keys;
+    std::vector<Chunk> chunks;
+    std::unordered_map<Code,std::uint32_t> shared;
+    std::size_t cardinality;
+  public:
+  // Constructors
+    Occupancy() noexcept;
+    static Occupancy region(std::pair<T,T> const& a, std::pair<T,T> const& b) noexcept;
+  // Public Methods
+    // Capacity
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+    memory::Usage memory_usage() const noexcept;
+    // Modifiers
+    template<typename U = std::vector<std::pair<T,T>>>
+    void insert(U&& u) noexcept;
+    template<typename U = std::vector<std::pair<T,T>>>
+    void erase(U&& u) noexcept;
+    void clear() noexcept;
+    void shrink_to_fit() noexcept;
+    // Lookup
+    bool contains(std::pair<T,T> const& a) const noexcept;
+    template<typename F>
+    void for_each(F&& f) const;
+    // Operations
+    Occupancy& operator|=(Occupancy const& rhs) noexcept;
+    Occupancy& operator&=(Occupancy const& rhs) noexcept;
+    Occupancy& operator-=(Occupancy const& rhs) noexcept;
+  private:
+  // Private Methods
+    // Lookup
+    std::size_t lower_bound(Key key) const noexcept;
+    // Modifiers
+    void recount() noexcept;
+  public:
+  // Static Assertions
+    static_assert(std::is_integral<T>::value, "T must be of an integral type");
+    static_assert(std::is_signed<T>::value, "T must be of a signed type");
+};
+
+//
+// Constructors
+//
+template<typename T>
+Occupancy<T>::Occupancy() noexcept
+  : cardinality(0)
+{
+  // Same as Density, see density.hpp
+  static_assert(sizeof(T) <= 4, "T must fit in 32 bits");
+}
+
+template<typename T>
+Occupancy<T> Occupancy<T>::region(std::pair<T,T> const& a,
+  std::pair<T,T> const& b) noexcept
+{
+  //
+  // Tiles fully covered by the rectangle are full chunks,
+  // only the ones along its border hold per cell data
+  //
+  Occupancy occupancy;
+
+  auto x1 { bias(std::min(a.first, b.first)) };
+  auto x2 { bias(std::max(a.first, b.first)) };
+  auto y1 { bias(std::min(a.second, b.second)) };
+  auto y2 { bias(std::max(a.second, b.second)) };
+
+  std::vector<std::pair<Key,Chunk>> tiles;
+
+  for( auto ty{y1 >> 8}; ty <= (y2 >> 8); ++ty )
+  {
+    for( auto tx{x1 >> 8}; tx <= (x2 >> 8); ++tx )
+    {
+      auto cx1 { std::max(x1, tx << 8) };
+      auto cx2 { std::min(x2, (tx << 8) | 255u) };
+      auto cy1 { std::max(y1, ty << 8) };
+      auto cy2 { std::min(y2, (ty << 8) | 255u) };
+
+      Chunk chunk;
+
+      if( cx2-cx1 == 255 && cy2-cy1 == 255 )
+      {
+        chunk.kind = Kind::FULL;
+        chunk.cardinality = CELLS;
+      }
+      else
+      {
+        chunk.to_bitmap();
+        for( auto y{cy1}; y <= cy2; ++y )
+        {
+          for( auto x{cx1}; x <= cx2; ++x )
+          {
+            auto low { static_cast<Low>((spread(x) | (spread(y) << 1)) & 0xFFFF) };
+            chunk.bitmap[low >> 6] |= std::uint64_t{1} << (low & 63);
+          }
+        }
+        chunk.cardinality = (cx2-cx1+1) * (cy2-cy1+1);
+        chunk.normalize();
+      }
+
+      tiles.emplace_back(spread(tx) | (spread(ty) << 1), std::move(chunk));
+    }
+  }
+
+  std::sort(tiles.begin(), tiles.end(),
+    [](auto const& l, auto const& r){ return l.first < r.first; });
+
+  for( auto& tile : tiles )
+  {
+    occupancy.keys.push_back(tile.first);
+    occupancy.chunks.push_back(std::move(tile.second));
+  }
+
+  occupancy.recount();
+  return occupancy;
+}
+
+//
+// Public Methods
+//
+template<typename T>
+std::size_t Occupancy<T>::size() const noexcept
+{
+  return this->cardinality;
+}
+
+template<typename T>
+bool Occupancy<T>::empty() const noexcept
+{
+  return this->cardinality == 0;
+}
+
+template<typename T>
+memory::Usage Occupancy<T>::memory_usage() const noexcept
+{
+  //
+  // Keys and chunk headers are the index, the cells are the
+  // arrays and bitmaps of the chunks; full chunks take none
+  //
+  auto usage { memory::vector(this->keys) };
+  usage += memory::vector(this->chunks);
+  usage.index += usage.payload;
+  usage.payload = 0;
+
+  for( auto const& chunk : this->chunks )
+  {
+    usage += memory::vector(chunk.array);
+    usage += memory::vector(chunk.bitmap);
+  }
+
+  usage += memory::hash(this->shared);
+  return usage;
+}
+
+template<typename T>
+template<typename U>
+void Occupancy<T>::insert(U&& u) noexcept
+{
+  for( auto const& entry : u )
+  {
+    auto code { encode<T>(entry) };
+    auto key { code >> 16 };
+    auto index { this->lower_bound(key) };
+
+    if( index == this->keys.size() || this->keys[index] != key )
+    {
+      this->keys.insert(this->keys.begin()+index, key);
+      this->chunks.emplace(this->chunks.begin()+index);
+    }
+
+    if( this->chunks[index].add(static_cast<Low>(code & 0xFFFF)) ) ++this->cardinality;
+    else ++this->shared[code];
+  }
+}
+
+template<typename T>
+template<typename U>
+void Occupancy<T>::erase(U&& u) noexcept
+{
+  for( auto const& entry : u )
+  {
+    auto code { encode<T>(entry) };
+
+    if( auto search {this->shared.find(code)}; search != this->shared.end() )
+    {
+      if( --search->second == 0 ) this->shared.erase(search);
+      continue;
+    }
+
+    auto key { code >> 16 };
+    auto index { this->lower_bound(key) };
+
+    if( index == this->keys.size() || this->keys[index] != key ) continue;
+
+    if( this->chunks[index].remove(static_cast<Low>(code & 0xFFFF)) ) --this->cardinality;
+
+    if( this->chunks[index].cardinality == 0 )
+    {
+      this->keys.erase(this->keys.begin()+index);
+      this->chunks.erase(this->chunks.begin()+index);
+    }
+  }
+}
+
+template<typename T>
+void Occupancy<T>::clear() noexcept
+{
+  *this = Occupancy<T>{};
+}
+
+template<typename T>
+void Occupancy<T>::shrink_to_fit() noexcept
+{
+  this->keys.shrink_to_fit();
+  this->chunks.shrink_to_fit();
+  for( auto& chunk : this->chunks )
+  {
+    chunk.array.shrink_to_fit();
+    chunk.bitmap.shrink_to_fit();
+  }
+  this->shared.rehash(0);
+}
+
+template<typename T>
+bool Occupancy<T>::contains(std::pair<T,T> const& a) const noexcept
+{
+  auto code { encode<T>(a) };
+  auto index { this->lower_bound(code >> 16) };
+
+  if( index == this->keys.size() || this->keys[index] != (code >> 16) ) return false;
+
+  return this->chunks[index].contains(static_cast<Low>(code & 0xFFFF));
+}
+
+template<typename T>
+template<typename F>
+void Occupancy<T>::for_each(F&& f) const
+{
+  for( std::size_t i{0}; i < this->keys.size(); ++i )
+  {
+    auto high { this->keys[i] << 16 };
+    this->chunks[i].for_each([&](Low low){ f(decode<T>(high | low)); });
+  }
+}
+
+template<typename T>
+Occupancy<T>& Occupancy<T>::operator|=(Occupancy const& rhs) noexcept
+{
+  std::vector<Key> keys;
+  std::vector<Chunk> chunks;
+  keys.reserve(this->keys.size() + rhs.keys.size());
+  chunks.reserve(this->keys.size() + rhs.keys.size());
+
+  std::size_t i{0}, j{0};
+  while( i < this->keys.size() || j < rhs.keys.size() )
+  {
+    if( j == rhs.keys.size() || (i < this->keys.size() && this->keys[i] < rhs.keys[j]) )
+    {
+      keys.push_back(this->keys[i]);
+      chunks.push_back(std::move(this->chunks[i++]));
+    }
+    else if( i == this->keys.size() || rhs.keys[j] < this->keys[i] )
+    {
+      keys.push_back(rhs.keys[j]);
+      chunks.push_back(rhs.chunks[j++]);
+    }
+    else
+    {
+      keys.push_back(this->keys[i]);
+      chunks.push_back(std::move(this->chunks[i++]));
+      chunks.back().unite(rhs.chunks[j++]);
+    }
+  }
+
+  this->keys = std::move(keys);
+  this->chunks = std::move(chunks);
+  this->shared.clear();
+  this->recount();
+  return *this;
+}
+
+template<typename T>
+Occupancy<T>& Occupancy<T>::operator&=(Occupancy const& rhs) noexcept
+{
+  std::size_t kept{0}, j{0};
+  for( std::size_t i{0}; i < this->keys.size(); ++i )
+  {
+    while( j < rhs.keys.size() && rhs.keys[j] < this->keys[i] ) ++j;
+    if( j == rhs.keys.size() ) break;
+    if( rhs.keys[j] != this->keys[i] ) continue;
+
+    this->chunks[i].intersect(rhs.chunks[j]);
+    if( this->chunks[i].cardinality == 0 ) continue;
+
+    if( kept != i )
+    {
+      this->keys[kept] = this->keys[i];
+      this->chunks[kept] = std::move(this->chunks[i]);
+    }
+    ++kept;
+  }
+
+  this->keys.resize(kept);
+  this->chunks.resize(kept);
+  this->shared.clear();
+  this->recount();
+  return *this;
+}
+
+template<typename T>
+Occupancy<T>& Occupancy<T>::operator-=(Occupancy const& rhs) noexcept
+{
+  std::size_t kept{0}, j{0};
+  for( std::size_t i{0}; i < this->keys.size(); ++i )
+  {
+    while( j < rhs.keys.size() && rhs.keys[j] < this->keys[i] ) ++j;
+    if( j < rhs.keys.size() && rhs.keys[j] == this->keys[i] )
+    {
+      this->chunks[i].subtract(rhs.chunks[j]);
+      if( this->chunks[i].cardinality == 0 ) continue;
+    }
+
+    if( kept != i )
+    {
+      this->keys[kept] = this->keys[i];
+      this->chunks[kept] = std::move(this->chunks[i]);
+    }
+    ++kept;
+  }
+
+  this->keys.resize(kept);
+  this->chunks.resize(kept);
+  this->shared.clear();
+  this->recount();
+  return *this;
+}
+
+//
+// Private Methods
+//
+template<typename T>
+std::size_t Occupancy<T>::lower_bound(Key key) const noexcept
+{
+  return static_cast<std::size_t>(std::distance(this->keys.cbegin(),
+    std::lower_bound(this->keys.cbegin(), this->keys.cend(), key)));
+}
+
+template<typename T>
+void Occupancy<T>::recount() noexcept
+{
+  this->cardinality = 0;
+  for( auto const& chunk : this->chunks ) this->cardinality += chunk.cardinality;
+}
+
+//
+// Operators
+//
+template<typename T>
+Occupancy<T> operator|(Occupancy<T> lhs, Occupancy<T> const& rhs) noexcept
+{
+  return lhs |= rhs;
+}
+
+template<typename T>
+Occupancy<T> operator&(Occupancy<T> lhs, Occupancy<T> const& rhs) noexcept
+{
+  return lhs &= rhs;
+}
+
+template<typename T>
+Occupancy<T> operator-(Occupancy<T> lhs, Occupancy<T> const& rhs) noexcept
+{
+  return lhs -= rhs;
+}
+
+} // namespace electra::occupancy
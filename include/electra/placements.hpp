@@ -12,66 +12,151 @@
 #include <map>
 #include <utility>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <fstream>
+#include <tuple>
+#include <vector>
+#include <algorithm>
 #include <type_traits>
+#if __has_include(<version>)
+#include <version>
+#endif
+#ifdef __cpp_lib_span
+#include <span>
+#endif
 
 #include <electra/area.hpp>
+#include <electra/arena.hpp>
+#include <electra/density.hpp>
+#include <electra/executor.hpp>
+#include <electra/occupancy.hpp>
+#include <electra/point.hpp>
+#include <electra/fingerprint.hpp>
+#include <electra/instrument.hpp>
+#include <electra/memory.hpp>
+#include <electra/routes.hpp>
+#include <electra/trace.hpp>
+#include <electra/timeline.hpp>
 #include <nlohmann/json.hpp>
 
 namespace electra::placement {
 
 // Data types
 template<typename T>
-using PlacementIdData = std::map< std::pair<T,T>, T >;
+using PlacementIdData = std::pmr::map< std::pair<T,T>, T >;
 template<typename T>
-using IdPlacementData = std::map< T, std::pair<T,T> >;
+using IdPlacementData = std::pmr::map< T, std::pair<T,T> >;
 template<typename T>
 using const_iterator = typename PlacementIdData<T>::const_iterator;
+template<typename T>
+using id_const_iterator = typename IdPlacementData<T>::const_iterator;
 
 // Dynamic memory storage
 template<typename T>
-using PlacementId = std::unique_ptr<PlacementIdData<T>>;
+using PlacementId = electra::arena::Pointer<PlacementIdData<T>>;
+template<typename T>
+using IdPlacement = electra::arena::Pointer<IdPlacementData<T>>;
+template<typename T>
+using Area = std::shared_ptr<electra::area::Area<T>>;
+template<typename T>
+using Density = std::unique_ptr<electra::density::Density<T>>;
 template<typename T>
-using IdPlacement = std::unique_ptr<IdPlacementData<T>>;
+using Occupancy = std::shared_ptr<electra::occupancy::Occupancy<T>>;
+using Fingerprint = std::unique_ptr<electra::fingerprint::Fingerprint>;
 template<typename T>
-using Area = std::unique_ptr<electra::area::Area<T>>;
+using Routes = std::shared_ptr<electra::routes::Cache<T>>;
+using Trace = std::shared_ptr<electra::trace::Trace>;
 
 template<typename T>
 class Placements
 {
   private:
   // Private Members
+    electra::instrument::Counters counters;
     PlacementId<T> placements_id;
     IdPlacement<T> id_placements;
     Area<T> area;
+    Density<T> density;
+    Occupancy<T> occupancy;
+    Fingerprint fingerprint;
+    Routes<T> routes;
+    Trace trace;
   public:
   // Constructors
-    Placements() noexcept;
+    explicit Placements(std::pmr::memory_resource* resource
+      = std::pmr::get_default_resource()) noexcept;
   // Iterators
     const_iterator<T> cbegin() const noexcept;
     const_iterator<T> cend() const noexcept;
+    id_const_iterator<T> id_cbegin() const noexcept;
+    id_const_iterator<T> id_cend() const noexcept;
   // Public Methods
     // Element Access
     template<typename U = std::pair<T,T>>
     std::optional<T> at(U&& u) const noexcept;
+    template<typename InIt, typename OutIt>
+    OutIt at(InIt it_beg, InIt it_end, OutIt out) const noexcept;
+#ifdef __cpp_lib_span
+    void at(std::span<std::pair<T,T> const> cells,
+      std::span<std::optional<T>> ids) const noexcept;
+#endif
     // Capacity
     auto size() const noexcept;
+    electra::memory::Usage memory_usage() const noexcept;
     // Modifiers
     template<typename U = std::pair<std::pair<T,T>,T>>
     void insert(U&& u) noexcept;
     template<typename U>
     void erase(U&& u) const noexcept;
+    template<typename InIt>
+    void insert(InIt it_beg, InIt it_end) noexcept;
+    template<typename InIt>
+    void erase(InIt it_beg, InIt it_end) noexcept;
+    template<typename U = std::pair<std::pair<T,T>,T>>
+    void move(U&& u) noexcept;
+    template<typename InIt>
+    void move(InIt&& it_beg, InIt&& it_end) noexcept;
+    void shrink_to_fit() noexcept;
     // Lookup
     template<typename U = T>
     std::optional<std::pair<T,T>> find(U&& u) const noexcept;
     std::pair<T,T> get_area() const noexcept;
-  // Private Methods
+    std::optional<std::pair<std::pair<T,T>,std::pair<T,T>>> get_bounds() const noexcept;
+    electra::density::Density<T> const* get_density() const noexcept;
+    electra::occupancy::Occupancy<T> const* get_occupancy() const noexcept;
+    electra::fingerprint::Fingerprint get_fingerprint() const noexcept;
+    electra::instrument::Stats get_stats() const noexcept;
+    electra::instrument::Stats get_area_stats() const noexcept;
+    template<typename Key = electra::point::Hilbert>
+    std::vector<std::pair<std::pair<T,T>,T>> ordered(Key key = {}) const noexcept;
     // Operations
+    template<typename U = T, typename = std::enable_if_t<(sizeof(U) <= 4)>>
+    void enable_density() noexcept;
+    template<typename U = T, typename = std::enable_if_t<(sizeof(U) <= 4)>>
+    void enable_occupancy(electra::executor::Executor* executor
+      = electra::executor::get_default()) noexcept;
+    void attach_routes(Routes<T> routes) noexcept;
+    void attach_area(Area<T> area) noexcept;
+    void attach_occupancy(Occupancy<T> occupancy) noexcept;
+    void attach_trace(Trace trace) noexcept;
     template<typename U>
     void write(U&& path) const noexcept;
     template<typename U>
     void read(U&& path) noexcept;
+  private:
+  // Private Methods
+    // Modifiers
+    template<typename U = std::vector<std::pair<T,T>>>
+    void occupy(U&& u) const noexcept;
+    template<typename U = std::vector<std::pair<T,T>>>
+    void vacate(U&& u) const noexcept;
+    void occupy_batch(std::vector<std::pair<T,T>>& cells) const noexcept;
+    void vacate_batch(std::vector<std::pair<T,T>>& cells) const noexcept;
+    // Lookup
+    template<typename M, typename It, typename K>
+    static It seek(M& map, It hint, K const& key, std::size_t& searches) noexcept;
+  public:
   // Static Assertions
     static_assert(std::is_integral<T>::value, "T must be of an integral type");
     static_assert(std::is_signed<T>::value, "T must be of a signed type");
@@ -81,13 +166,16 @@ class Placements
 // Constructors
 //
 template<typename T>
-Placements<T>::Placements() noexcept
-  : placements_id(std::make_unique<
-      typename PlacementId<T>::element_type>())
-  , id_placements(std::make_unique<
-      typename IdPlacement<T>::element_type>())
-  , area(std::make_unique<
-      typename Area<T>::element_type>())
+Placements<T>::Placements(std::pmr::memory_resource* resource) noexcept
+  : counters(resource)
+  , placements_id(electra::arena::make<
+      typename PlacementId<T>::element_type>(this->counters.resource()))
+  , id_placements(electra::arena::make<
+      typename IdPlacement<T>::element_type>(this->counters.resource()))
+  , area(electra::arena::share<
+      typename Area<T>::element_type>(resource))
+  , fingerprint(std::make_unique<
+      typename Fingerprint::element_type>())
 {
 }
 
@@ -106,6 +194,18 @@ const_iterator<T> Placements<T>::cend() const noexcept
   return this->placements_id->cend();
 }
 
+template<typename T>
+id_const_iterator<T> Placements<T>::id_cbegin() const noexcept
+{
+  return this->id_placements->cbegin();
+}
+
+template<typename T>
+id_const_iterator<T> Placements<T>::id_cend() const noexcept
+{
+  return this->id_placements->cend();
+}
+
 //
 // Public Methods
 //
@@ -114,6 +214,10 @@ template<typename T>
 template<typename U>
 std::optional<T> Placements<T>::at(U&& u) const noexcept
 {
+  if( this->trace ) this->trace->op(electra::trace::Op::AT).cell(std::pair<T,T>(u));
+  auto timer { this->counters.time() };
+  this->counters.count(&electra::instrument::Stats::probes);
+
   auto search { this->placements_id->find(u) };
 
   if ( search == this->placements_id->cend() )
@@ -121,18 +225,132 @@ std::optional<T> Placements<T>::at(U&& u) const noexcept
   return search->second;
 }
 
+template<typename T>
+template<typename InIt, typename OutIt>
+OutIt Placements<T>::at(InIt it_beg, InIt it_end, OutIt out) const noexcept
+{
+  electra::timeline::Scope scope {"placements.at"};
+  auto timer { this->counters.time() };
+
+  //
+  // Algorithm's Description:
+  //   Queries are answered in the order of the map rather than
+  //   the given one, each one is sought from the entry found
+  //   for the previous one; consecutive searches share the
+  //   upper levels of the tree, which stay in cache. Cells
+  //   missing from the occupancy, when one is kept, never
+  //   reach the map.
+  //
+  // Cavefeats:
+  //   The output iterator must be random access, the ids are
+  //   written at the position of their cell.
+  //
+
+  //
+  // Cells are sorted by their packed word where they fit one,
+  // it orders as the pair and compares in a single step
+  //
+  auto pack = [](std::pair<T,T> const& cell)
+  {
+    if constexpr ( sizeof(T) <= 4 ) return electra::point::Point<T>(cell).get_word();
+    else return cell;
+  };
+  struct Query
+  {
+    decltype(pack(std::pair<T,T>{})) key;
+    std::pair<T,T> cell;
+    std::size_t index;
+  };
+
+  std::vector<Query> queries;
+  std::size_t n {0};
+  for( auto it{it_beg}; it != it_end; ++it, ++n )
+  {
+    std::pair<T,T> cell(*it);
+    if( this->trace ) this->trace->op(electra::trace::Op::AT).cell(cell);
+    out[n] = std::nullopt;
+    if( this->occupancy && ! this->occupancy->contains(cell) ) continue;
+    queries.push_back({pack(cell), cell, n});
+  }
+
+  std::sort(queries.begin(), queries.end(),
+    [](Query const& a, Query const& b) { return a.key < b.key; });
+
+  auto const& map { *this->placements_id };
+  auto hint { map.cbegin() };
+  std::size_t searches {0};
+  for( auto const& [_, cell, index] : queries )
+  {
+    hint = seek(map, hint, cell, searches);
+    if( hint != map.cend() && hint->first == cell ) out[index] = hint->second;
+  }
+  this->counters.count(&electra::instrument::Stats::probes, searches);
+
+  return out + static_cast<std::ptrdiff_t>(n);
+}
+
+#ifdef __cpp_lib_span
+template<typename T>
+void Placements<T>::at(std::span<std::pair<T,T> const> cells,
+  std::span<std::optional<T>> ids) const noexcept
+{
+  // An id is written for every cell, a shorter output is not touched
+  if( ids.size() < cells.size() ) return;
+  this->at(cells.begin(), cells.end(), ids.begin());
+}
+#endif
+
 template<typename T>
 auto Placements<T>::size() const noexcept
 {
   return this->id_placements->size();
 }
 
+template<typename T>
+electra::memory::Usage Placements<T>::memory_usage() const noexcept
+{
+  //
+  // Attached state is counted as if it was owned, an area or
+  // occupancy shared between containers is counted by each
+  // one of them; routes and traces are left out
+  //
+  auto resource { this->counters.resource() };
+
+  auto usage { electra::memory::object<PlacementIdData<T>>(resource) };
+  usage += electra::memory::map(*this->placements_id);
+  usage += electra::memory::object<IdPlacementData<T>>(resource);
+  usage += electra::memory::map(*this->id_placements);
+  usage += electra::memory::shared<electra::area::Area<T>>(resource);
+  usage += this->area->memory_usage();
+  usage += electra::memory::object<electra::fingerprint::Fingerprint>();
+
+  if( this->density )
+  {
+    usage += electra::memory::object<electra::density::Density<T>>();
+    usage += this->density->memory_usage();
+  }
+  if( this->occupancy )
+  {
+    usage += electra::memory::shared<electra::occupancy::Occupancy<T>>();
+    usage += this->occupancy->memory_usage();
+  }
+
+  return usage;
+}
+
 template<typename T>
 template<typename U>
 void Placements<T>::insert(U&& u) noexcept
 {
-  this->area->insert({u.first});
-  this->id_placements->insert({u.second,u.first});
+  if( this->trace ) this->trace->op(electra::trace::Op::INSERT).cell(u.first).id(u.second);
+  auto timer { this->counters.time() };
+  this->counters.count(&electra::instrument::Stats::probes, 2);
+
+  this->occupy({u.first});
+  if( this->id_placements->insert({u.second,u.first}).second )
+  {
+    *this->fingerprint += electra::fingerprint::placement(u.first, u.second);
+  }
   this->placements_id->insert(std::forward<U>(u));
 }
 
@@ -140,19 +358,216 @@ template<typename T>
 template<typename U>
 void Placements<T>::erase(U&& u) const noexcept
 {
+  if( this->trace ) this->trace->op(electra::trace::Op::ERASE).id(static_cast<T>(u));
+  auto timer { this->counters.time() };
+  this->counters.count(&electra::instrument::Stats::probes, 2);
+
   auto search {this->id_placements->find(u)};
   if ( search != this->id_placements->end() )
   {
-    this->area->erase( {search->second} );
-    this->placements_id->erase(search->second);
+    this->vacate( {search->second} );
+    *this->fingerprint -= electra::fingerprint::placement(search->second, search->first);
+
+    //
+    // Overlapping placements share a region, which
+    // must only be released by the id owning it
+    //
+    auto owner {this->placements_id->find(search->second)};
+    if( owner != this->placements_id->end() && owner->second == search->first )
+    {
+      this->placements_id->erase(owner);
+    }
+
     this->id_placements->erase(search);
   }
 }
 
+template<typename T>
+template<typename InIt>
+void Placements<T>::insert(InIt it_beg, InIt it_end) noexcept
+{
+  electra::timeline::Scope scope {"placements.insert"};
+  auto timer { this->counters.time() };
+
+  //
+  // Entries are sorted stably, so that the first of a
+  // repeated id or cell wins, as with insert(u)
+  //
+  struct Entry { std::pair<T,T> cell; T id; };
+  std::vector<Entry> entries;
+  std::vector<std::pair<T,T>> cells;
+
+  for( auto it{it_beg}; it != it_end; ++it )
+  {
+    if( this->trace ) this->trace->op(electra::trace::Op::INSERT).cell(it->first).id(it->second);
+    entries.push_back({it->first, it->second});
+    cells.push_back(it->first);
+  }
+
+  this->occupy_batch(cells);
+
+  //
+  // Each map is merged with the entries sorted by its key,
+  // every insertion is hinted with the node following the
+  // previous one, so runs of new keys take no search. Keys
+  // are radix sorted as words that order as ids and cells
+  //
+  electra::point::sort(entries.begin(), entries.end(), [](T id)
+  {
+    return static_cast<std::uint64_t>(static_cast<std::int64_t>(id)) ^ (std::uint64_t{1} << 63);
+  }, &Entry::id);
+
+  //
+  // The hint is the first node past the key, new keys go right
+  // before it; stepping past the inserted node instead would
+  // climb the tree whenever it is the last of a subtree
+  //
+  std::size_t searches {0};
+  auto id_hint { this->id_placements->begin() };
+  for( std::size_t k{0}; k < entries.size(); ++k )
+  {
+    auto const& entry { entries[k] };
+    if( k > 0 && entries[k-1].id == entry.id ) continue;
+
+    id_hint = seek(*this->id_placements, id_hint, entry.id, searches);
+    if( id_hint != this->id_placements->end() && id_hint->first == entry.id ) continue;
+
+    this->id_placements->emplace_hint(id_hint, entry.id, entry.cell);
+    *this->fingerprint += electra::fingerprint::placement(entry.cell, entry.id);
+  }
+
+  if constexpr ( sizeof(T) <= 4 )
+  {
+    electra::point::sort(entries.begin(), entries.end(), [](std::pair<T,T> const& cell)
+    {
+      return static_cast<std::uint64_t>(electra::point::Point<T>(cell).get_word());
+    }, &Entry::cell);
+  }
+  else
+  {
+    std::stable_sort(entries.begin(), entries.end(),
+      [](auto const& l, auto const& r) { return l.cell < r.cell; });
+  }
+
+  auto hint { this->placements_id->begin() };
+  for( std::size_t k{0}; k < entries.size(); ++k )
+  {
+    auto const& entry { entries[k] };
+    if( k > 0 && entries[k-1].cell == entry.cell ) continue;
+
+    hint = seek(*this->placements_id, hint, entry.cell, searches);
+    if( hint != this->placements_id->end() && hint->first == entry.cell ) continue;
+
+    this->placements_id->emplace_hint(hint, entry.cell, entry.id);
+  }
+  this->counters.count(&electra::instrument::Stats::probes, searches);
+}
+
+template<typename T>
+template<typename InIt>
+void Placements<T>::erase(InIt it_beg, InIt it_end) noexcept
+{
+  electra::timeline::Scope scope {"placements.erase"};
+  auto timer { this->counters.time() };
+
+  std::vector<T> ids;
+  for( auto it{it_beg}; it != it_end; ++it )
+  {
+    if( this->trace ) this->trace->op(electra::trace::Op::ERASE).id(static_cast<T>(*it));
+    ids.push_back(static_cast<T>(*it));
+  }
+
+  //
+  // Both maps are walked in the order of their keys, ids
+  // first and then the cells of the erased placements, and
+  // each key erased at the node found; a repeated id is
+  // erased once
+  //
+  std::size_t searches {0};
+
+  std::sort(ids.begin(), ids.end());
+
+  std::vector<std::pair<std::pair<T,T>,T>> erased;
+  auto id_hint { this->id_placements->begin() };
+  for( auto id : ids )
+  {
+    id_hint = seek(*this->id_placements, id_hint, id, searches);
+    if ( id_hint == this->id_placements->end() || id_hint->first != id ) continue;
+
+    erased.emplace_back(id_hint->second, id);
+    *this->fingerprint -= electra::fingerprint::placement(id_hint->second, id);
+    id_hint = this->id_placements->erase(id_hint);
+  }
+
+  if constexpr ( sizeof(T) <= 4 )
+  {
+    electra::point::sort(erased.begin(), erased.end(), [](std::pair<T,T> const& cell)
+    {
+      return static_cast<std::uint64_t>(electra::point::Point<T>(cell).get_word());
+    }, [](auto const& entry) { return entry.first; });
+  }
+  else
+  {
+    std::sort(erased.begin(), erased.end());
+  }
+
+  // Same as erase(u), a shared region is released by its owner
+  std::vector<std::pair<T,T>> cells;
+  auto hint { this->placements_id->begin() };
+  for( auto const& [cell, id] : erased )
+  {
+    cells.push_back(cell);
+    hint = seek(*this->placements_id, hint, cell, searches);
+    if( hint != this->placements_id->end() && hint->first == cell && hint->second == id )
+    {
+      hint = this->placements_id->erase(hint);
+    }
+  }
+  this->counters.count(&electra::instrument::Stats::probes, searches);
+
+  this->vacate_batch(cells);
+}
+
+template<typename T>
+template<typename U>
+void Placements<T>::move(U&& u) noexcept
+{
+  this->erase(u.second);
+  this->insert(std::forward<U>(u));
+}
+
+template<typename T>
+template<typename InIt>
+void Placements<T>::move(InIt&& it_beg, InIt&& it_end) noexcept
+{
+  electra::timeline::Scope scope {"placements.move"};
+  //
+  // Release every region before taking the new ones,
+  // so placements can move into each other's region
+  //
+  std::vector<T> ids;
+  for( auto it{it_beg}; it != it_end; ++it ) ids.push_back(it->second);
+
+  this->erase(ids.cbegin(), ids.cend());
+  this->insert(it_beg, it_end);
+}
+
+template<typename T>
+void Placements<T>::shrink_to_fit() noexcept
+{
+  // Map nodes are released on erase, only the attached state keeps slack
+  if( this->density ) this->density->shrink_to_fit();
+  if( this->occupancy ) this->occupancy->shrink_to_fit();
+}
+
 template<typename T>
 template<typename U>
 std::optional<std::pair<T,T>> Placements<T>::find(U&& u) const noexcept
 {
+  if( this->trace ) this->trace->op(electra::trace::Op::FIND).id(static_cast<T>(u));
+  auto timer { this->counters.time() };
+  this->counters.count(&electra::instrument::Stats::probes);
+
   auto search { this->id_placements->find(u) };
 
   if ( search == this->id_placements->cend() )
@@ -166,24 +581,159 @@ std::pair<T,T> Placements<T>::get_area() const noexcept
   return this->area->get_area();
 }
 
-//
-// Private Methods
-//
+template<typename T>
+std::optional<std::pair<std::pair<T,T>,std::pair<T,T>>>
+Placements<T>::get_bounds() const noexcept
+{
+  return this->area->get_bounds();
+}
+
+template<typename T>
+electra::density::Density<T> const* Placements<T>::get_density() const noexcept
+{
+  return this->density.get();
+}
+
+template<typename T>
+electra::occupancy::Occupancy<T> const* Placements<T>::get_occupancy() const noexcept
+{
+  return this->occupancy.get();
+}
+
+template<typename T>
+electra::fingerprint::Fingerprint Placements<T>::get_fingerprint() const noexcept
+{
+  return *this->fingerprint;
+}
+
+template<typename T>
+electra::instrument::Stats Placements<T>::get_stats() const noexcept
+{
+  return this->counters.get();
+}
+
+template<typename T>
+electra::instrument::Stats Placements<T>::get_area_stats() const noexcept
+{
+  return this->area->get_stats();
+}
+
+template<typename T>
+template<typename Key>
+std::vector<std::pair<std::pair<T,T>,T>> Placements<T>::ordered(Key key) const noexcept
+{
+  //
+  // A contiguous copy of the placements along a curve, so
+  // that spatial passes visit neighbouring regions together
+  //
+  std::vector<std::pair<std::pair<T,T>,T>> placements(this->cbegin(), this->cend());
+  electra::point::sort(placements.begin(), placements.end(), key,
+    [](auto const& entry) { return entry.first; });
+  return placements;
+}
 
 //
 // Operations
 //
+template<typename T>
+template<typename U, typename>
+void Placements<T>::enable_density() noexcept
+{
+  electra::timeline::Scope scope {"placements.enable_density"};
+  //
+  // The density map is only kept when requested,
+  // it is filled with the current placements
+  //
+  this->density = std::make_unique<electra::density::Density<T>>();
+
+  for( auto it{this->cbegin()}; it != this->cend(); ++it )
+  {
+    this->density->insert({it->first});
+  }
+}
+
+template<typename T>
+template<typename U, typename>
+void Placements<T>::enable_occupancy(electra::executor::Executor* executor) noexcept
+{
+  electra::timeline::Scope scope {"placements.enable_occupancy"};
+  //
+  // The occupancy bitmap is only kept when requested,
+  // it is filled with the current placements in morton
+  // order, so each chunk is filled in a single run
+  //
+  this->occupancy = std::make_shared<electra::occupancy::Occupancy<T>>();
+
+  std::vector<std::pair<T,T>> cells;
+  cells.reserve(this->placements_id->size());
+  for( auto it{this->cbegin()}; it != this->cend(); ++it ) cells.push_back(it->first);
+
+  electra::point::sort(executor, cells.begin(), cells.end(), electra::point::Morton{});
+  this->occupancy->insert(cells);
+}
+
+template<typename T>
+void Placements<T>::attach_routes(Routes<T> routes) noexcept
+{
+  //
+  // The route cache may be shared with other containers,
+  // edits invalidate the routes depending on their cells
+  //
+  this->routes = std::move(routes);
+}
+
+template<typename T>
+void Placements<T>::attach_area(Area<T> area) noexcept
+{
+  //
+  // The area may be shared with other containers, which
+  // then keep a single set of histograms; it is expected
+  // to already hold the cells of these placements
+  //
+  this->area = std::move(area);
+}
+
+template<typename T>
+void Placements<T>::attach_occupancy(Occupancy<T> occupancy) noexcept
+{
+  // Same as attach_area, a null occupancy detaches it
+  this->occupancy = std::move(occupancy);
+}
+
+template<typename T>
+void Placements<T>::attach_trace(Trace trace) noexcept
+{
+  //
+  // Every lookup and edit is logged to the trace, moves as
+  // the erase and insert they are made of; a null trace
+  // stops the recording
+  //
+  this->trace = std::move(trace);
+}
+
 template<typename T>
 template<typename U>
 void Placements<T>::write(U&& path) const noexcept
 {
+  electra::timeline::Scope scope {"placements.write"};
   using Json = nlohmann::json;
 
+  //
+  // The area may be shared with other containers, the one
+  // written only holds the cells of these placements
+  //
+  std::vector<std::pair<T,T>> cells;
+  cells.reserve(this->placements_id->size());
+  for( auto it{this->cbegin()}; it != this->cend(); ++it ) cells.push_back(it->first);
+
+  electra::area::Area<T> area;
+  area.insert(cells.cbegin(), cells.cend());
+
   Json j1, j2, j3;
 
   j1 = *this->placements_id;
   j2 = *this->id_placements;
-  j3 = *this->area;
+  j3 = area;
 
   std::ofstream os1{std::forward<U>(path) + std::string{"pid.json"}};
   std::ofstream os2{std::forward<U>(path) + std::string{"idp.json"}};
@@ -199,27 +749,116 @@ template<typename T>
 template<typename U>
 void Placements<T>::read(U&& path) noexcept
 {
+  electra::timeline::Scope scope {"placements.read"};
   using Json = nlohmann::json;
 
   std::ifstream is1{std::forward<U>(path) + std::string{"pid.json"}};
   std::ifstream is2{std::forward<U>(path) + std::string{"idp.json"}};
-  std::ifstream is3{std::forward<U>(path) + std::string{"area.json"}};
-
-  if( ! is1.good() || ! is2.good() || ! is3.good() ) return;
 
-  Json j1, j2, j3;
+  if( ! is1.good() || ! is2.good() ) return;
 
-  is1 >> j1; is2 >> j2; is3 >> j3;
+  Json j1, j2;
 
-  this->placements_id = std::make_unique<PlacementIdData<T>>();
-  this->id_placements = std::make_unique<IdPlacementData<T>>();
-  this->area = std::make_unique<electra::area::Area<T>>();
+  is1 >> j1; is2 >> j2;
 
+  //
+  // The area and occupancy may be shared with other
+  // containers, the previous cells are released from them and
+  // the loaded ones taken, in place of replacing them; the
+  // area file is then only kept for other readers
+  //
+  std::vector<std::pair<T,T>> cells;
+  cells.reserve(this->placements_id->size());
+  for( auto it{this->cbegin()}; it != this->cend(); ++it ) cells.push_back(it->first);
+  this->vacate_batch(cells);
 
   *this->placements_id = j1.get<PlacementIdData<T>>();
   *this->id_placements = j2.get<IdPlacementData<T>>();
-  *this->area = j3.get<electra::area::Area<T>>();
+
+  cells.clear();
+  for( auto it{this->cbegin()}; it != this->cend(); ++it ) cells.push_back(it->first);
+  this->occupy_batch(cells);
+
+  *this->fingerprint = {};
+  for( auto it{this->id_cbegin()}; it != this->id_cend(); ++it )
+  {
+    *this->fingerprint += electra::fingerprint::placement(it->second, it->first);
+  }
+}
+
+//
+// Private Methods
+//
+template<typename T>
+template<typename U>
+void Placements<T>::occupy(U&& u) const noexcept
+{
+  this->area->insert(u);
+  if( this->density ) this->density->insert(u);
+  if( this->occupancy ) this->occupancy->insert(u);
+  if( this->routes ) this->routes->invalidate(u);
 }
 
+template<typename T>
+template<typename U>
+void Placements<T>::vacate(U&& u) const noexcept
+{
+  this->area->erase(u);
+  if( this->density ) this->density->erase(u);
+  if( this->occupancy ) this->occupancy->erase(u);
+  if( this->routes ) this->routes->invalidate(u);
+}
+
+template<typename T>
+void Placements<T>::occupy_batch(std::vector<std::pair<T,T>>& cells) const noexcept
+{
+  //
+  // Same as occupy, the area is updated with the count of
+  // each coordinate and the occupancy in morton order
+  //
+  this->area->insert(cells.cbegin(), cells.cend());
+  if( this->density ) this->density->insert(cells);
+  if( this->occupancy )
+  {
+    electra::point::sort(cells.begin(), cells.end(), electra::point::Morton{});
+    this->occupancy->insert(cells);
+  }
+  if( this->routes ) this->routes->invalidate(cells);
+}
+
+template<typename T>
+void Placements<T>::vacate_batch(std::vector<std::pair<T,T>>& cells) const noexcept
+{
+  this->area->erase(cells.cbegin(), cells.cend());
+  if( this->density ) this->density->erase(cells);
+  if( this->occupancy )
+  {
+    electra::point::sort(cells.begin(), cells.end(), electra::point::Morton{});
+    this->occupancy->erase(cells);
+  }
+  if( this->routes ) this->routes->invalidate(cells);
+}
+
+//
+// First node of the map whose key is not less than the key,
+// reached by walking from the hint when a few steps do, else
+// searched from the root; keys sought in increasing order
+// share the cached upper levels of the tree
+//
+template<typename T>
+template<typename M, typename It, typename K>
+It Placements<T>::seek(M& map, It hint, K const& key, std::size_t& searches) noexcept
+{
+  constexpr std::size_t STEPS {8};
+
+  std::size_t k {0};
+  while( k < STEPS && hint != map.end() && hint->first < key ) { ++hint; ++k; }
+  if( k == STEPS )
+  {
+    hint = map.lower_bound(key);
+    ++searches;
+  }
+  return hint;
+}
 
 } // namespace electra::placement
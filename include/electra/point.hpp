@@ -0,0 +1,381 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : point
+// @created     : Sunday Oct 25, 2026 15:31:09 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <map>
+#include <set>
+#include <array>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <memory_resource>
+#include <type_traits>
+
+#include <electra/executor.hpp>
+
+namespace electra::point
+{
+
+//
+// Coordinates are biased to unsigned so that the order of
+// negative values is kept; wider values are truncated, so the
+// maps keyed on them assert a type of at most 32 bits
+//
+template<typename T>
+constexpr std::uint32_t bias(T v) noexcept
+{
+  return static_cast<std::uint32_t>(v) ^ 0x80000000u;
+}
+
+template<typename T>
+constexpr T unbias(std::uint32_t v) noexcept
+{
+  return static_cast<T>(static_cast<std::int32_t>(v ^ 0x80000000u));
+}
+
+//
+// Morton codes
+//   Interleaves the bits of both coordinates, the first one
+//   in the even bits
+//
+constexpr std::uint64_t spread(std::uint32_t v) noexcept
+{
+  std::uint64_t x { v };
+  x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+  x = (x | (x << 8))  & 0x00FF00FF00FF00FFull;
+  x = (x | (x << 4))  & 0x0F0F0F0F0F0F0F0Full;
+  x = (x | (x << 2))  & 0x3333333333333333ull;
+  x = (x | (x << 1))  & 0x5555555555555555ull;
+  return x;
+}
+
+constexpr std::uint32_t compact(std::uint64_t x) noexcept
+{
+  x &= 0x5555555555555555ull;
+  x = (x | (x >> 1))  & 0x3333333333333333ull;
+  x = (x | (x >> 2))  & 0x0F0F0F0F0F0F0F0Full;
+  x = (x | (x >> 4))  & 0x00FF00FF00FF00FFull;
+  x = (x | (x >> 8))  & 0x0000FFFF0000FFFFull;
+  x = (x | (x >> 16)) & 0x00000000FFFFFFFFull;
+  return static_cast<std::uint32_t>(x);
+}
+
+template<typename T>
+constexpr std::uint64_t morton(std::pair<T,T> const& a) noexcept
+{
+  return spread(bias(a.first)) | (spread(bias(a.second)) << 1);
+}
+
+template<typename T>
+constexpr std::pair<T,T> from_morton(std::uint64_t code) noexcept
+{
+  return {unbias<T>(compact(code)), unbias<T>(compact(code >> 1))};
+}
+
+//
+// Hilbert codes
+//   Position of the cell along the Hilbert curve filling the
+//   2^32 x 2^32 grid of biased coordinates. Unlike the Morton
+//   order, consecutive codes are always neighbouring cells
+//
+template<typename T>
+constexpr std::uint64_t hilbert(std::pair<T,T> const& a) noexcept
+{
+  std::uint32_t x { bias(a.first) };
+  std::uint32_t y { bias(a.second) };
+  std::uint64_t code {0};
+
+  for( std::uint32_t s{0x80000000u}; s > 0; s >>= 1 )
+  {
+    std::uint32_t rx { (x & s) ? 1u : 0u };
+    std::uint32_t ry { (y & s) ? 1u : 0u };
+    code += std::uint64_t{s} * std::uint64_t{s} * ((3u * rx) ^ ry);
+
+    // Rotate the quadrant, the bits below s are the only ones read
+    if( ry == 0 )
+    {
+      if( rx == 1 ) { x = ~x; y = ~y; }
+      auto t { x }; x = y; y = t;
+    }
+  }
+
+  return code;
+}
+
+template<typename T>
+constexpr std::pair<T,T> from_hilbert(std::uint64_t code) noexcept
+{
+  std::uint32_t x {0}, y {0};
+
+  for( std::uint64_t s{1}; s <= 0x80000000u; s <<= 1 )
+  {
+    std::uint32_t rx { static_cast<std::uint32_t>(1 & (code >> 1)) };
+    std::uint32_t ry { static_cast<std::uint32_t>(1 & (code ^ rx)) };
+
+    if( ry == 0 )
+    {
+      if( rx == 1 )
+      {
+        x = static_cast<std::uint32_t>(s - 1 - x);
+        y = static_cast<std::uint32_t>(s - 1 - y);
+      }
+      auto t { x }; x = y; y = t;
+    }
+
+    x += static_cast<std::uint32_t>(s * rx);
+    y += static_cast<std::uint32_t>(s * ry);
+    code >>= 2;
+  }
+
+  return {unbias<T>(x), unbias<T>(y)};
+}
+
+//
+// Key functors, usable as the ordering of containers
+//
+struct Morton
+{
+  template<typename T>
+  constexpr std::uint64_t operator()(std::pair<T,T> const& a) const noexcept
+  {
+    return morton(a);
+  }
+};
+
+struct Hilbert
+{
+  template<typename T>
+  constexpr std::uint64_t operator()(std::pair<T,T> const& a) const noexcept
+  {
+    return hilbert(a);
+  }
+};
+
+template<typename Key>
+struct Less
+{
+  using is_transparent = void;
+  template<typename T>
+  constexpr bool operator()(std::pair<T,T> const& a, std::pair<T,T> const& b) const noexcept
+  {
+    return Key{}(a) < Key{}(b);
+  }
+};
+
+// Containers ordered along a curve
+template<typename T, typename V, typename Key = Hilbert>
+using Map = std::pmr::map<std::pair<T,T>, V, Less<Key>>;
+template<typename T, typename Key = Hilbert>
+using Set = std::pmr::set<std::pair<T,T>, Less<Key>>;
+
+struct Identity
+{
+  template<typename U>
+  constexpr U const& operator()(U const& u) const noexcept { return u; }
+};
+
+//
+// Algorithm's Description:
+//   Stable sort of keyed elements on their key, a byte per
+//   pass from the lowest one. The counts of every byte are
+//   taken in a single pass, bytes shared by every key are
+//   skipped, so close keys take a few passes; small ranges
+//   are merge sorted instead.
+//
+template<typename V>
+void radix(std::vector<std::pair<std::uint64_t,V>>& keyed)
+{
+  constexpr std::size_t SMALL {64};
+
+  if( keyed.size() < SMALL )
+  {
+    std::stable_sort(keyed.begin(), keyed.end(),
+      [](auto const& a, auto const& b) { return a.first < b.first; });
+    return;
+  }
+
+  std::array<std::array<std::size_t,256>,8> counts {};
+  for( auto const& entry : keyed )
+  {
+    for( std::size_t byte{0}; byte < 8; ++byte ) ++counts[byte][(entry.first >> (8*byte)) & 0xFF];
+  }
+
+  std::vector<std::pair<std::uint64_t,V>> buffer(keyed.size());
+  for( std::size_t byte{0}; byte < 8; ++byte )
+  {
+    auto& count { counts[byte] };
+    if( count[(keyed.front().first >> (8*byte)) & 0xFF] == keyed.size() ) continue;
+
+    std::size_t offset {0};
+    for( auto& c : count ) offset += std::exchange(c, offset);
+    for( auto& entry : keyed ) buffer[count[(entry.first >> (8*byte)) & 0xFF]++] = std::move(entry);
+    keyed.swap(buffer);
+  }
+}
+
+//
+// Sorts a range along a curve, projecting each element to its
+// cell; keys are computed once per element, and elements of
+// equal keys keep their order
+//
+template<typename RandIt, typename Key = Hilbert, typename P = Identity>
+void sort(RandIt it_beg, RandIt it_end, Key key = {}, P cell = {})
+{
+  using V = typename std::iterator_traits<RandIt>::value_type;
+
+  std::vector<std::pair<std::uint64_t,V>> keyed;
+  keyed.reserve(static_cast<std::size_t>(std::distance(it_beg, it_end)));
+  for( auto it{it_beg}; it != it_end; ++it )
+  {
+    keyed.emplace_back(key(std::invoke(cell, *it)), std::move(*it));
+  }
+
+  radix(keyed);
+
+  auto out { it_beg };
+  for( auto& entry : keyed ) *out++ = std::move(entry.second);
+}
+
+//
+// Same as above, keys are computed and sorted on an executor;
+// the order is the same as the one of the serial sort
+//
+template<typename RandIt, typename Key = Hilbert, typename P = Identity>
+void sort(executor::Executor* executor, RandIt it_beg, RandIt it_end,
+  Key key = {}, P cell = {})
+{
+  using V = typename std::iterator_traits<RandIt>::value_type;
+
+  auto n { static_cast<std::size_t>(std::distance(it_beg, it_end)) };
+  std::vector<std::pair<std::uint64_t,V>> keyed(n);
+  executor::for_each(executor, n, 0, [&](std::size_t beg, std::size_t end)
+  {
+    for( auto k{beg}; k < end; ++k )
+    {
+      keyed[k].first = key(std::invoke(cell, it_beg[k]));
+      keyed[k].second = std::move(it_beg[k]);
+    }
+  });
+
+  executor::sort(executor, keyed.begin(), keyed.end(),
+    [](auto const& a, auto const& b) { return a.first < b.first; });
+
+  executor::for_each(executor, n, 0, [&](std::size_t beg, std::size_t end)
+  {
+    for( auto k{beg}; k < end; ++k ) it_beg[k] = std::move(keyed[k].second);
+  });
+}
+
+//
+// Two coordinates packed in a single word, 32 bits wide for
+// coordinates of up to 16 bits, 64 bits wide otherwise. Words
+// compare as the pair of coordinates they hold
+//
+template<typename T>
+class Point
+{
+  public:
+  // Public Types
+    using Word = std::conditional_t<(sizeof(T) <= 2), std::uint32_t, std::uint64_t>;
+    using Half = std::conditional_t<(sizeof(T) <= 2), std::uint16_t, std::uint32_t>;
+  private:
+  // Private Members
+    Word word;
+    static constexpr unsigned BITS { sizeof(Half) * 8 };
+    static constexpr Half SIGN { static_cast<Half>(Half{1} << (BITS - 1)) };
+  public:
+  // Constructors
+    constexpr Point() noexcept;
+    constexpr Point(T x, T y) noexcept;
+    constexpr Point(std::pair<T,T> const& a) noexcept;
+  // Public Methods
+    // Element Access
+    constexpr T x() const noexcept;
+    constexpr T y() const noexcept;
+    constexpr Word get_word() const noexcept;
+    constexpr operator std::pair<T,T>() const noexcept;
+    // Operators
+    constexpr bool operator==(Point const& rhs) const noexcept { return this->word == rhs.word; }
+    constexpr bool operator!=(Point const& rhs) const noexcept { return this->word != rhs.word; }
+    constexpr bool operator<(Point const& rhs) const noexcept { return this->word < rhs.word; }
+  public:
+  // Static Assertions
+    static_assert(std::is_integral<T>::value, "T must be of an integral type");
+    static_assert(std::is_signed<T>::value, "T must be of a signed type");
+    static_assert(sizeof(T) <= 4, "T must fit in 32 bits");
+};
+
+//
+// Constructors
+//
+template<typename T>
+constexpr Point<T>::Point() noexcept
+  : Point(T{0}, T{0})
+{
+}
+
+template<typename T>
+constexpr Point<T>::Point(T x, T y) noexcept
+  : word( (Word{static_cast<Half>(static_cast<Half>(x) ^ SIGN)} << BITS)
+    | Word{static_cast<Half>(static_cast<Half>(y) ^ SIGN)} )
+{
+}
+
+template<typename T>
+constexpr Point<T>::Point(std::pair<T,T> const& a) noexcept
+  : Point(a.first, a.second)
+{
+}
+
+//
+// Public Methods
+//
+template<typename T>
+constexpr T Point<T>::x() const noexcept
+{
+  return static_cast<T>(static_cast<Half>(static_cast<Half>(this->word >> BITS) ^ SIGN));
+}
+
+template<typename T>
+constexpr T Point<T>::y() const noexcept
+{
+  return static_cast<T>(static_cast<Half>(static_cast<Half>(this->word) ^ SIGN));
+}
+
+template<typename T>
+constexpr typename Point<T>::Word Point<T>::get_word() const noexcept
+{
+  return this->word;
+}
+
+template<typename T>
+constexpr Point<T>::operator std::pair<T,T>() const noexcept
+{
+  return {this->x(), this->y()};
+}
+
+} // namespace electra::point
+
+namespace std
+{
+
+template<typename T>
+struct hash<electra::point::Point<T>>
+{
+  std::size_t operator()(electra::point::Point<T> const& p) const noexcept
+  {
+    return std::hash<typename electra::point::Point<T>::Word>{}(p.get_word());
+  }
+};
+
+} // namespace std
@@ -0,0 +1,140 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : random
+// @created     : Wednesday Oct 21, 2026 09:10:12 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <cstdint>
+#include <limits>
+
+namespace electra::random
+{
+
+//
+// Algorithm's Description:
+//   Generators and distributions with the same output on every
+//   platform, unlike the ones of <random> whose distributions
+//   are implementation defined. A run with a given seed can
+//   then be reproduced anywhere.
+//
+
+//
+// SplitMix64, used to seed and to hash
+//
+inline std::uint64_t mix(std::uint64_t x) noexcept
+{
+  x += 0x9E3779B97F4A7C15ull;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+  return x ^ (x >> 31);
+}
+
+//
+// Seed derived from a base seed and a list of stream
+// indexes, such as a replica and an iteration
+//
+template<typename... Args>
+std::uint64_t seed(std::uint64_t base, Args... args) noexcept
+{
+  auto s { mix(base) };
+  ((s = mix(s ^ static_cast<std::uint64_t>(args))), ...);
+  return s;
+}
+
+//
+// Xoshiro256**
+//
+class Generator
+{
+  private:
+  // Private Members
+    std::uint64_t s[4];
+  public:
+  // Public Members
+    using result_type = std::uint64_t;
+  // Constructors
+    explicit Generator(std::uint64_t seed = 0) noexcept;
+  // Operators
+    std::uint64_t operator()() noexcept;
+  // Public Methods
+    // Distributions
+    std::uint64_t below(std::uint64_t n) noexcept;
+    template<typename T>
+    T between(T a, T b) noexcept;
+    double uniform() noexcept;
+    // Limits
+    static constexpr std::uint64_t min() noexcept { return 0; }
+    static constexpr std::uint64_t max() noexcept
+    {
+      return std::numeric_limits<std::uint64_t>::max();
+    }
+};
+
+//
+// Constructors
+//
+inline Generator::Generator(std::uint64_t seed) noexcept
+{
+  for( auto& word : this->s )
+  {
+    seed = mix(seed);
+    word = seed;
+  }
+}
+
+//
+// Operators
+//
+inline std::uint64_t Generator::operator()() noexcept
+{
+  auto rotl = [](std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); };
+
+  auto result { rotl(this->s[1] * 5, 7) * 9 };
+  auto t { this->s[1] << 17 };
+
+  this->s[2] ^= this->s[0];
+  this->s[3] ^= this->s[1];
+  this->s[1] ^= this->s[2];
+  this->s[0] ^= this->s[3];
+  this->s[2] ^= t;
+  this->s[3] = rotl(this->s[3], 45);
+
+  return result;
+}
+
+//
+// Public Methods
+//
+
+// Uniform integer in [0,n), by rejection of the biased tail
+inline std::uint64_t Generator::below(std::uint64_t n) noexcept
+{
+  if( n == 0 ) return 0;
+  auto limit { std::numeric_limits<std::uint64_t>::max()
+    - std::numeric_limits<std::uint64_t>::max() % n };
+  std::uint64_t x;
+  do { x = (*this)(); } while( x >= limit );
+  return x % n;
+}
+
+// Uniform integer in [a,b]
+template<typename T>
+T Generator::between(T a, T b) noexcept
+{
+  auto span { static_cast<std::uint64_t>(b) - static_cast<std::uint64_t>(a) };
+  if( span == std::numeric_limits<std::uint64_t>::max() ) return static_cast<T>((*this)());
+  return static_cast<T>(static_cast<std::uint64_t>(a) + this->below(span + 1));
+}
+
+// Uniform real in [0,1)
+inline double Generator::uniform() noexcept
+{
+  return static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+}
+
+} // namespace electra::random
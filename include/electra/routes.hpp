@@ -0,0 +1,275 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : routes
+// @created     : Thursday Oct 22, 2026 09:14:26 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <map>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+#include <unordered_map>
+#include <type_traits>
+
+namespace electra::routes
+{
+
+//
+// Algorithm's Description:
+//   Encoded routes kept by their pair of endpoints, each one
+//   with the rectangular region its search depended on. The
+//   regions are indexed in a grid of square buckets, so an edit
+//   of a cell only looks at the routes of its bucket, and only
+//   the ones whose region holds the cell are invalidated.
+//
+// Cavefeats:
+//   A route whose region spans many buckets is listed in each
+//   one of them, buckets should be about the size of a route.
+//
+template<typename T>
+class Cache
+{
+  private:
+  // Private Types
+    using Cell = std::pair<T,T>;
+    using Endpoints = std::pair<Cell,Cell>;
+    using Route = std::vector<Cell>;
+    struct Entry
+    {
+      Route route;
+      Cell a;
+      Cell b;
+    };
+  // Private Members
+    T side;
+    std::map<Endpoints,Entry> entries;
+    std::unordered_map<std::uint64_t,std::vector<Endpoints>> buckets;
+    std::uint64_t hit_count;
+    std::uint64_t miss_count;
+  public:
+  // Constructors
+    explicit Cache(T side = 16) noexcept;
+  // Public Methods
+    // Capacity
+    std::size_t size() const noexcept;
+    std::uint64_t hits() const noexcept;
+    std::uint64_t misses() const noexcept;
+    // Modifiers
+    template<typename U = Route>
+    void insert(Cell const& source, Cell const& target, U&& encoded,
+      Cell const& a, Cell const& b) noexcept;
+    template<typename U = Route>
+    void insert(Cell const& source, Cell const& target, U&& encoded) noexcept;
+    void erase(Cell const& source, Cell const& target) noexcept;
+    void clear() noexcept;
+    // Lookup
+    Route const* find(Cell const& source, Cell const& target) noexcept;
+    // Operations
+    std::size_t invalidate(Cell const& a, Cell const& b) noexcept;
+    template<typename U = std::vector<Cell>>
+    std::size_t invalidate(U&& u) noexcept;
+  private:
+  // Private Methods
+    // Lookup
+    T bucket(T t) const noexcept;
+    static std::uint64_t key(T x, T y) noexcept;
+    // Modifiers
+    void unlink(Endpoints const& endpoints, Entry const& entry) noexcept;
+  public:
+  // Static Assertions
+    static_assert(std::is_integral<T>::value, "T must be of an integral type");
+    static_assert(std::is_signed<T>::value, "T must be of a signed type");
+};
+
+//
+// Constructors
+//
+template<typename T>
+Cache<T>::Cache(T side) noexcept
+  : side(std::max<T>(side, 1))
+  , hit_count(0)
+  , miss_count(0)
+{
+}
+
+//
+// Public Methods
+//
+template<typename T>
+std::size_t Cache<T>::size() const noexcept
+{
+  return this->entries.size();
+}
+
+template<typename T>
+std::uint64_t Cache<T>::hits() const noexcept
+{
+  return this->hit_count;
+}
+
+template<typename T>
+std::uint64_t Cache<T>::misses() const noexcept
+{
+  return this->miss_count;
+}
+
+template<typename T>
+template<typename U>
+void Cache<T>::insert(Cell const& source, Cell const& target, U&& encoded,
+  Cell const& a, Cell const& b) noexcept
+{
+  this->erase(source, target);
+
+  Endpoints endpoints { source, target };
+  Entry entry { Route(std::cbegin(encoded), std::cend(encoded)),
+    {std::min(a.first, b.first), std::min(a.second, b.second)},
+    {std::max(a.first, b.first), std::max(a.second, b.second)} };
+
+  for( auto x{this->bucket(entry.a.first)}; x <= this->bucket(entry.b.first); ++x )
+  {
+    for( auto y{this->bucket(entry.a.second)}; y <= this->bucket(entry.b.second); ++y )
+    {
+      this->buckets[key(x,y)].push_back(endpoints);
+    }
+  }
+
+  this->entries.emplace(endpoints, std::move(entry));
+}
+
+template<typename T>
+template<typename U>
+void Cache<T>::insert(Cell const& source, Cell const& target, U&& encoded) noexcept
+{
+  //
+  // Without a region the route only depends on the cells of
+  // its bounding box, the points of the encoded route
+  //
+  Cell a { source }, b { source };
+  for( std::size_t i{0}; i < std::size(encoded); i += 2 )
+  {
+    auto const& cell { *(std::cbegin(encoded) + i) };
+    a = {std::min(a.first, cell.first), std::min(a.second, cell.second)};
+    b = {std::max(b.first, cell.first), std::max(b.second, cell.second)};
+  }
+  this->insert(source, target, std::forward<U>(encoded), a, b);
+}
+
+template<typename T>
+void Cache<T>::erase(Cell const& source, Cell const& target) noexcept
+{
+  auto search { this->entries.find({source, target}) };
+  if( search == this->entries.end() ) return;
+  this->unlink(search->first, search->second);
+  this->entries.erase(search);
+}
+
+template<typename T>
+void Cache<T>::clear() noexcept
+{
+  this->entries.clear();
+  this->buckets.clear();
+}
+
+template<typename T>
+typename Cache<T>::Route const* Cache<T>::find(Cell const& source, Cell const& target) noexcept
+{
+  auto search { this->entries.find({source, target}) };
+  if( search == this->entries.end() )
+  {
+    ++this->miss_count;
+    return nullptr;
+  }
+  ++this->hit_count;
+  return &search->second.route;
+}
+
+template<typename T>
+std::size_t Cache<T>::invalidate(Cell const& a, Cell const& b) noexcept
+{
+  Cell lo { std::min(a.first, b.first), std::min(a.second, b.second) };
+  Cell hi { std::max(a.first, b.first), std::max(a.second, b.second) };
+
+  //
+  // Routes listed in the buckets of the edited region, whose
+  // own region intersects it
+  //
+  std::vector<Endpoints> stale;
+  for( auto x{this->bucket(lo.first)}; x <= this->bucket(hi.first); ++x )
+  {
+    for( auto y{this->bucket(lo.second)}; y <= this->bucket(hi.second); ++y )
+    {
+      auto search { this->buckets.find(key(x,y)) };
+      if( search == this->buckets.end() ) continue;
+      for( auto const& endpoints : search->second )
+      {
+        auto const& entry { this->entries.find(endpoints)->second };
+        if( entry.a.first <= hi.first && lo.first <= entry.b.first
+          && entry.a.second <= hi.second && lo.second <= entry.b.second )
+        {
+          stale.push_back(endpoints);
+        }
+      }
+    }
+  }
+
+  std::sort(stale.begin(), stale.end());
+  stale.erase(std::unique(stale.begin(), stale.end()), stale.end());
+
+  for( auto const& endpoints : stale ) this->erase(endpoints.first, endpoints.second);
+
+  return stale.size();
+}
+
+template<typename T>
+template<typename U>
+std::size_t Cache<T>::invalidate(U&& u) noexcept
+{
+  if( this->entries.empty() ) return 0;
+
+  std::size_t count {0};
+  for( auto const& cell : u ) count += this->invalidate(cell, cell);
+  return count;
+}
+
+//
+// Private Methods
+//
+template<typename T>
+T Cache<T>::bucket(T t) const noexcept
+{
+  // Rounds towards negative infinity
+  return t >= 0 ? t / this->side : -((-t - 1) / this->side) - 1;
+}
+
+template<typename T>
+std::uint64_t Cache<T>::key(T x, T y) noexcept
+{
+  return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32)
+    | static_cast<std::uint32_t>(y);
+}
+
+template<typename T>
+void Cache<T>::unlink(Endpoints const& endpoints, Entry const& entry) noexcept
+{
+  for( auto x{this->bucket(entry.a.first)}; x <= this->bucket(entry.b.first); ++x )
+  {
+    for( auto y{this->bucket(entry.a.second)}; y <= this->bucket(entry.b.second); ++y )
+    {
+      auto search { this->buckets.find(key(x,y)) };
+      if( search == this->buckets.end() ) continue;
+      auto& list { search->second };
+      auto it { std::find(list.begin(), list.end(), endpoints) };
+      if( it != list.end() ) { *it = list.back(); list.pop_back(); }
+      if( list.empty() ) this->buckets.erase(search);
+    }
+  }
+}
+
+} // namespace electra::routes
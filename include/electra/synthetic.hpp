@@ -0,0 +1,440 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : synthetic
+// @created     : Monday Oct 26, 2026 14:22:51 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <cmath>
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstdint>
+#include <optional>
+#include <algorithm>
+#include <type_traits>
+
+#include <electra/random.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+#include <electra/timeline.hpp>
+
+namespace electra::synthetic
+{
+
+// Data types
+enum class Kind
+{
+  // Placements spread uniformly over the grid
+  UNIFORM,
+  // Placements gathered around random centers
+  CLUSTERED,
+  // Placements on a regular lattice, wires between neighbours
+  MESH,
+  // 2DDWave clocking, tiles on a lattice and wires that only
+  // flow eastwards and southwards
+  FLOW,
+};
+
+struct Options
+{
+  // Base seed, workloads with the same seed and options are equal
+  std::uint64_t seed {0};
+  // Grid the placements are drawn from, at least as many cells
+  // as placements for the uniform and clustered kinds
+  std::size_t width {1024};
+  std::size_t height {1024};
+  std::size_t placements {0};
+  std::size_t wires {0};
+  // Mean number of cells of a wire, and chance of a bend at
+  // each step of the random kinds
+  double length {16};
+  double bend {0.1};
+  // Clustered kind, number of centers and spread around them
+  std::size_t clusters {16};
+  double spread {16};
+  // Distance between placements of the mesh and flow kinds
+  std::size_t pitch {5};
+};
+
+template<typename T>
+struct Workload
+{
+  std::vector<std::pair<std::pair<T,T>,T>> placements;
+  std::vector<std::vector<std::pair<T,T>>> wires;
+};
+
+//
+// Algorithm's Description:
+//   Placements are drawn without repetition, a bitmap of the grid
+//   rejects taken cells. Wires are random walks: each step moves
+//   along a single axis, and turns left or right with the bend
+//   probability; their lengths follow a geometric distribution
+//   around the mean. Mesh and flow wires connect lattice
+//   neighbours instead, flow wires are monotone staircases going
+//   east and south only, as required by the 2DDWave scheme.
+//   Every wire changes one coordinate at a time, as expected by
+//   wire::encode.
+//
+// Cavefeats:
+//   Wires of the random kinds may cross each other and the
+//   placements, the way unrouted nets do.
+//
+template<typename T>
+class Synthetic
+{
+  private:
+  // Private Types
+    using Cell = std::pair<T,T>;
+    using Wire = std::vector<Cell>;
+  // Private Members
+    Options options;
+    random::Generator generator;
+    std::vector<bool> taken;
+    static constexpr double PI { 3.14159265358979323846 };
+  public:
+  // Constructors
+    explicit Synthetic(Options const& options) noexcept;
+  // Public Methods
+    Workload<T> generate(Kind kind);
+  private:
+  // Private Methods
+    // Placements
+    bool take(Cell const& cell) noexcept;
+    void uniform(Workload<T>& workload);
+    void clustered(Workload<T>& workload);
+    void lattice(Workload<T>& workload);
+    // Wires
+    std::size_t length() noexcept;
+    Wire walk() noexcept;
+    Wire staircase(Cell from, Cell const& to) noexcept;
+    static Cell shift(Cell const& cell, T dx, T dy) noexcept;
+    void walks(Workload<T>& workload);
+    void neighbours(Workload<T>& workload, bool flow);
+  public:
+  // Static Assertions
+    static_assert(std::is_integral<T>::value, "T must be of an integral type");
+    static_assert(std::is_signed<T>::value, "T must be of a signed type");
+};
+
+//
+// Constructors
+//
+template<typename T>
+Synthetic<T>::Synthetic(Options const& options) noexcept
+  : options(options)
+  , generator(random::seed(options.seed))
+{
+  this->options.width = std::max<std::size_t>(this->options.width, 1);
+  this->options.height = std::max<std::size_t>(this->options.height, 1);
+  this->options.pitch = std::max<std::size_t>(this->options.pitch, 2);
+}
+
+//
+// Public Methods
+//
+template<typename T>
+Workload<T> Synthetic<T>::generate(Kind kind)
+{
+  Workload<T> workload;
+
+  switch (kind)
+  {
+    case Kind::UNIFORM:
+      this->uniform(workload);
+      this->walks(workload);
+      break;
+    case Kind::CLUSTERED:
+      this->clustered(workload);
+      this->walks(workload);
+      break;
+    case Kind::MESH:
+      this->lattice(workload);
+      this->neighbours(workload, false);
+      break;
+    case Kind::FLOW:
+      this->lattice(workload);
+      this->neighbours(workload, true);
+      break;
+  }
+
+  return workload;
+}
+
+//
+// Private Methods
+//
+template<typename T>
+bool Synthetic<T>::take(Cell const& cell) noexcept
+{
+  auto index { static_cast<std::size_t>(cell.second) * this->options.width
+    + static_cast<std::size_t>(cell.first) };
+  if( this->taken[index] ) return false;
+  this->taken[index] = true;
+  return true;
+}
+
+template<typename T>
+void Synthetic<T>::uniform(Workload<T>& workload)
+{
+  auto cells { this->options.width * this->options.height };
+  auto n { std::min(this->options.placements, cells) };
+
+  this->taken.assign(cells, false);
+  workload.placements.reserve(n);
+
+  for( T id{0}; workload.placements.size() < n; )
+  {
+    Cell cell { static_cast<T>(this->generator.below(this->options.width)),
+      static_cast<T>(this->generator.below(this->options.height)) };
+    if( this->take(cell) ) workload.placements.push_back({cell, id++});
+  }
+}
+
+template<typename T>
+void Synthetic<T>::clustered(Workload<T>& workload)
+{
+  auto cells { this->options.width * this->options.height };
+  auto n { std::min(this->options.placements, cells) };
+
+  this->taken.assign(cells, false);
+  workload.placements.reserve(n);
+
+  std::vector<std::pair<double,double>> centers;
+  for( std::size_t k{0}; k < std::max<std::size_t>(this->options.clusters, 1); ++k )
+  {
+    centers.emplace_back(
+      this->generator.uniform() * static_cast<double>(this->options.width),
+      this->generator.uniform() * static_cast<double>(this->options.height));
+  }
+
+  //
+  // Normal offsets around a random center, by Box-Muller; a
+  // crowded center falls back to a uniform cell
+  //
+  for( T id{0}; workload.placements.size() < n; )
+  {
+    auto const& center { centers[this->generator.below(centers.size())] };
+    Cell cell {};
+    bool found {false};
+
+    for( int attempt{0}; attempt < 8 && ! found; ++attempt )
+    {
+      auto r { this->options.spread * std::sqrt(-2 * std::log(1 - this->generator.uniform())) };
+      auto theta { 2 * PI * this->generator.uniform() };
+      auto x { std::floor(center.first + r * std::cos(theta)) };
+      auto y { std::floor(center.second + r * std::sin(theta)) };
+      if( x < 0 || y < 0 || x >= static_cast<double>(this->options.width)
+        || y >= static_cast<double>(this->options.height) ) continue;
+      cell = { static_cast<T>(x), static_cast<T>(y) };
+      found = this->take(cell);
+    }
+
+    while( ! found )
+    {
+      cell = { static_cast<T>(this->generator.below(this->options.width)),
+        static_cast<T>(this->generator.below(this->options.height)) };
+      found = this->take(cell);
+    }
+
+    workload.placements.push_back({cell, id++});
+  }
+}
+
+template<typename T>
+void Synthetic<T>::lattice(Workload<T>& workload)
+{
+  //
+  // A square lattice, row by row, the grid options are
+  // ignored
+  //
+  auto n { this->options.placements };
+  auto side { static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(n)))) };
+  auto pitch { this->options.pitch };
+
+  workload.placements.reserve(n);
+  for( std::size_t k{0}; k < n; ++k )
+  {
+    workload.placements.push_back({ { static_cast<T>(k % side * pitch),
+      static_cast<T>(k / side * pitch) }, static_cast<T>(k) });
+  }
+}
+
+template<typename T>
+std::size_t Synthetic<T>::length() noexcept
+{
+  // Geometric number of cells with the given mean, at least two
+  auto p { 1 / std::max(this->options.length - 1, 1.0) };
+  auto u { 1 - this->generator.uniform() };
+  return 2 + static_cast<std::size_t>(std::floor(std::log(u) / std::log1p(-std::min(p, 0.999999))));
+}
+
+template<typename T>
+typename Synthetic<T>::Wire Synthetic<T>::walk() noexcept
+{
+  static constexpr Cell directions[] { {1,0}, {0,1}, {-1,0}, {0,-1} };
+
+  auto n { this->length() };
+  auto w { static_cast<T>(this->options.width) };
+  auto h { static_cast<T>(this->options.height) };
+
+  Wire wire;
+  wire.reserve(n);
+  wire.push_back({ static_cast<T>(this->generator.below(this->options.width)),
+    static_cast<T>(this->generator.below(this->options.height)) });
+
+  auto d { this->generator.below(4) };
+  while( wire.size() < n )
+  {
+    //
+    // Turns are of a quarter, so a wire never walks back
+    // over its last cell; the borders force a turn
+    //
+    if( this->generator.uniform() < this->options.bend ) d = (d + 1 + 2 * this->generator.below(2)) % 4;
+
+    auto const& last { wire.back() };
+    auto next { shift(last, directions[d].first, directions[d].second) };
+
+    if( next.first < 0 || next.second < 0 || next.first >= w || next.second >= h )
+    {
+      d = (d + 1 + 2 * this->generator.below(2)) % 4;
+      next = shift(last, directions[d].first, directions[d].second);
+      if( next.first < 0 || next.second < 0 || next.first >= w || next.second >= h )
+      {
+        d = (d + 2) % 4;
+        next = shift(last, directions[d].first, directions[d].second);
+      }
+      if( next.first < 0 || next.second < 0 || next.first >= w || next.second >= h ) break;
+    }
+
+    wire.push_back(next);
+  }
+
+  return wire;
+}
+
+template<typename T>
+typename Synthetic<T>::Wire Synthetic<T>::staircase(Cell from, Cell const& to) noexcept
+{
+  //
+  // Monotone path, keeps its direction and bends with the
+  // bend probability while both axes are left
+  //
+  Wire wire;
+  wire.reserve(static_cast<std::size_t>((to.first - from.first) + (to.second - from.second) + 1));
+  wire.push_back(from);
+
+  bool east { this->generator.below(2) == 0 };
+  while( from != to )
+  {
+    if( from.first == to.first ) east = false;
+    else if( from.second == to.second ) east = true;
+    else if( this->generator.uniform() < this->options.bend ) east = ! east;
+
+    from = east ? shift(from, 1, 0) : shift(from, 0, 1);
+    wire.push_back(from);
+  }
+
+  return wire;
+}
+
+template<typename T>
+typename Synthetic<T>::Cell Synthetic<T>::shift(Cell const& cell, T dx, T dy) noexcept
+{
+  return { static_cast<T>(cell.first + dx), static_cast<T>(cell.second + dy) };
+}
+
+template<typename T>
+void Synthetic<T>::walks(Workload<T>& workload)
+{
+  workload.wires.reserve(this->options.wires);
+  for( std::size_t k{0}; k < this->options.wires; ++k )
+  {
+    workload.wires.push_back(this->walk());
+  }
+}
+
+template<typename T>
+void Synthetic<T>::neighbours(Workload<T>& workload, bool flow)
+{
+  //
+  // Wires leave each lattice cell towards its east and south
+  // neighbours, starting and ending next to the placements
+  //
+  auto n { workload.placements.size() };
+  if( n < 2 ) return;
+
+  auto side { static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(n)))) };
+  auto pitch { static_cast<T>(this->options.pitch) };
+
+  workload.wires.reserve(this->options.wires);
+  for( std::size_t k{0}; workload.wires.size() < this->options.wires; ++k )
+  {
+    auto index { flow ? k % n : this->generator.below(n) };
+    auto const& cell { workload.placements[index].first };
+    bool east_free { index % side + 1 < side && index + 1 < n };
+    bool south_free { index + side < n };
+    if( ! east_free && ! south_free ) continue;
+
+    bool east { east_free && ( ! south_free || this->generator.below(2) == 0 ) };
+
+    if( ! flow )
+    {
+      auto from { east ? shift(cell, 1, 0) : shift(cell, 0, 1) };
+      auto to { east ? shift(cell, pitch - 1, 0) : shift(cell, 0, pitch - 1) };
+      workload.wires.push_back(this->staircase(from, to));
+      continue;
+    }
+
+    //
+    // Flow wires may also reach the diagonal neighbour, always
+    // moving eastwards or southwards, and ending west of it
+    //
+    bool diagonal { east_free && south_free && this->generator.below(2) == 0 };
+    auto from { east || diagonal ? shift(cell, 1, 0) : shift(cell, 0, 1) };
+    auto to { diagonal ? shift(cell, pitch - 1, pitch)
+      : east ? shift(cell, pitch - 1, 0) : shift(cell, 0, pitch - 1) };
+
+    workload.wires.push_back(this->staircase(from, to));
+  }
+}
+
+//
+// Generates a workload of the given kind
+//
+template<typename T>
+Workload<T> generate(Kind kind, Options const& options)
+{
+  return Synthetic<T>(options).generate(kind);
+}
+
+//
+// Fills the containers with a workload
+//
+template<typename T>
+void fill(Workload<T> const& workload, placement::Placements<T>& placements,
+  wire::Wires<T>& wires) noexcept
+{
+  timeline::Scope scope {"synthetic.fill"};
+
+  for( auto const& placement : workload.placements ) placements.insert(placement);
+  for( auto const& wire : workload.wires ) wires.insert(wire);
+}
+
+//
+// Kinds by name, for command line tools
+//
+inline std::optional<Kind> kind(std::string const& name) noexcept
+{
+  if( name == "uniform" ) return Kind::UNIFORM;
+  if( name == "clustered" ) return Kind::CLUSTERED;
+  if( name == "mesh" ) return Kind::MESH;
+  if( name == "flow" ) return Kind::FLOW;
+  return std::nullopt;
+}
+
+} // namespace electra::synthetic
@@ -0,0 +1,279 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : timeline
+// @created     : Wednesday Oct 28, 2026 09:35:12 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <string>
+#include <cstdint>
+#include <fstream>
+
+#include <nlohmann/json.hpp>
+
+#ifdef ELECTRA_TIMELINE
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace electra::timeline
+{
+
+#ifdef ELECTRA_TIMELINE
+inline constexpr bool enabled {true};
+#else
+inline constexpr bool enabled {false};
+#endif
+
+// Events kept by each thread, older ones are overwritten
+inline constexpr std::size_t CAPACITY {1 << 14};
+
+#ifdef ELECTRA_TIMELINE
+//
+// Algorithm's Description:
+//   Ring buffer of the events of a single thread. Only the
+//   owning thread writes, it fills a slot and then publishes it
+//   by advancing the head with release ordering; readers take
+//   the head with acquire ordering, copy the last slots, and
+//   drop the ones the writer may have overwritten meanwhile.
+//   Neither side ever waits on the other.
+//
+class Ring
+{
+  private:
+  // Private Types
+    struct Slot
+    {
+      std::atomic<char const*> name {nullptr};
+      std::atomic<std::uint64_t> begin {0};
+      std::atomic<std::uint64_t> end {0};
+    };
+  // Private Members
+    std::array<Slot,CAPACITY> slots;
+    std::atomic<std::uint64_t> head;
+    std::uint64_t thread;
+  public:
+  // Constructors
+    explicit Ring(std::uint64_t thread) noexcept
+      : head(0)
+      , thread(thread)
+    {
+    }
+  // Public Methods
+    void push(char const* name, std::uint64_t begin, std::uint64_t end) noexcept
+    {
+      auto h { this->head.load(std::memory_order_relaxed) };
+      auto& slot { this->slots[h % CAPACITY] };
+      slot.name.store(name, std::memory_order_relaxed);
+      slot.begin.store(begin, std::memory_order_relaxed);
+      slot.end.store(end, std::memory_order_relaxed);
+      this->head.store(h + 1, std::memory_order_release);
+    }
+
+    template<typename F>
+    void for_each(F&& f) const noexcept
+    {
+      struct Copy { char const* name; std::uint64_t begin, end; };
+
+      auto last { this->head.load(std::memory_order_acquire) };
+      auto first { last > CAPACITY ? last - CAPACITY : 0 };
+
+      std::vector<Copy> copies;
+      copies.reserve(static_cast<std::size_t>(last - first));
+      for( auto h{first}; h < last; ++h )
+      {
+        auto const& slot { this->slots[h % CAPACITY] };
+        copies.push_back({slot.name.load(std::memory_order_relaxed),
+          slot.begin.load(std::memory_order_relaxed),
+          slot.end.load(std::memory_order_relaxed)});
+      }
+
+      //
+      // Slots reused by the writer while they were copied, and
+      // the one it may be filling, are dropped
+      //
+      std::atomic_thread_fence(std::memory_order_acquire);
+      auto now { this->head.load(std::memory_order_relaxed) };
+      auto skip { now + 1 > first + CAPACITY ? now + 1 - first - CAPACITY : 0 };
+
+      for( auto k{skip}; k < copies.size(); ++k )
+      {
+        f(this->thread, copies[k].name, copies[k].begin, copies[k].end);
+      }
+    }
+};
+
+inline std::uint64_t nanoseconds() noexcept
+{
+  return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+//
+// Time stamp counter where available, it is about twice as
+// cheap to read as the steady clock; ticks are converted to
+// nanoseconds when the events are flushed
+//
+inline std::uint64_t ticks() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return nanoseconds();
+#endif
+}
+
+//
+// Rings of every thread that emitted an event, along with the
+// origin of the timeline; the list is only locked when a
+// thread emits its first event
+//
+class Registry
+{
+  private:
+  // Private Members
+    std::mutex mutex;
+    std::vector<std::shared_ptr<Ring>> rings;
+  public:
+  // Public Members
+    std::uint64_t origin_ticks {ticks()};
+    std::uint64_t origin_nanoseconds {nanoseconds()};
+    // Events starting before it are dropped
+    std::atomic<std::uint64_t> since {0};
+  // Public Methods
+    Ring* add() noexcept
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->rings.push_back(std::make_shared<Ring>(this->rings.size() + 1));
+      return this->rings.back().get();
+    }
+
+    std::vector<std::shared_ptr<Ring>> get() noexcept
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      return this->rings;
+    }
+};
+
+inline Registry& registry() noexcept
+{
+  static Registry registry;
+  return registry;
+}
+
+inline Ring& ring() noexcept
+{
+  //
+  // Rings are owned by the registry, so the events of a
+  // finished thread are still flushed
+  //
+  thread_local Ring* ring { registry().add() };
+  return *ring;
+}
+#endif
+
+//
+// Records the time between its construction and destruction
+// as an event of the calling thread; names must be string
+// literals, or outlive the flush
+//
+class Scope
+{
+  private:
+  // Private Members
+#ifdef ELECTRA_TIMELINE
+    char const* name;
+    std::uint64_t begin;
+#endif
+  public:
+  // Constructors
+    explicit Scope([[maybe_unused]] char const* name) noexcept
+#ifdef ELECTRA_TIMELINE
+      : name(name)
+      , begin(ticks())
+#endif
+    {
+    }
+    Scope(Scope const&) = delete;
+    Scope& operator=(Scope const&) = delete;
+    ~Scope()
+    {
+#ifdef ELECTRA_TIMELINE
+      ring().push(this->name, this->begin, ticks());
+#endif
+    }
+};
+
+//
+// The events of every thread in the Chrome trace event
+// format, viewable in Perfetto or chrome://tracing; times are
+// in microseconds
+//
+inline nlohmann::json json() noexcept
+{
+  auto events = nlohmann::json::array();
+
+#ifdef ELECTRA_TIMELINE
+  //
+  // Ticks are scaled by their rate since the origin, read
+  // again at each flush
+  //
+  auto& r { registry() };
+  auto since { r.since.load() };
+  auto elapsed_ticks { static_cast<double>(ticks() - r.origin_ticks) };
+  auto elapsed_nanoseconds { static_cast<double>(nanoseconds() - r.origin_nanoseconds) };
+  auto rate { elapsed_ticks > 0 ? elapsed_nanoseconds / elapsed_ticks : 1.0 };
+
+  for( auto const& ring : r.get() )
+  {
+    ring->for_each([&](std::uint64_t thread, char const* name,
+      std::uint64_t begin, std::uint64_t end)
+    {
+      if( begin < since || begin < r.origin_ticks ) return;
+      events.push_back({
+        {"name", name},
+        {"cat", "electra"},
+        {"ph", "X"},
+        {"ts", static_cast<double>(begin - r.origin_ticks) * rate / 1000},
+        {"dur", static_cast<double>(end - begin) * rate / 1000},
+        {"pid", 1},
+        {"tid", thread}});
+    });
+  }
+#endif
+
+  return nlohmann::json{{"traceEvents", events}, {"displayTimeUnit", "ns"}};
+}
+
+template<typename U>
+void write(U&& path) noexcept
+{
+  std::ofstream os{std::forward<U>(path)};
+
+  if( ! os.good() ) return;
+
+  os << json();
+}
+
+//
+// Drops the events recorded so far
+//
+inline void clear() noexcept
+{
+#ifdef ELECTRA_TIMELINE
+  registry().since.store(ticks());
+#endif
+}
+
+} // namespace electra::timeline
@@ -0,0 +1,495 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : trace
+// @created     : Tuesday Oct 27, 2026 09:12:40 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+#include <map>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <algorithm>
+#include <type_traits>
+
+namespace electra::trace
+{
+
+// Data types
+enum class Op : std::uint8_t
+{
+  // Placements
+  AT,
+  FIND,
+  INSERT,
+  ERASE,
+  // Wires
+  WIRE_FIND,
+  WIRE_INSERT,
+  WIRE_ERASE,
+  SPLIT,
+  JOIN,
+  TRUNCATE,
+  REPLACE,
+  WIRE_ERASE_HANDLE,
+  WIRE_ERASE_BATCH,
+};
+
+//
+// Shape of the record of each operation, its number of cells,
+// and whether a list of cells, an id and a handle follow them
+//
+struct Shape
+{
+  std::uint8_t cells;
+  bool list;
+  bool id;
+  bool handle;
+};
+
+inline constexpr Shape shapes[]
+{
+  {1, false, false, false}, // AT
+  {0, false, true,  false}, // FIND
+  {1, false, true,  false}, // INSERT
+  {0, false, true,  false}, // ERASE
+  {2, false, false, false}, // WIRE_FIND
+  {0, true,  false, false}, // WIRE_INSERT
+  {2, false, false, false}, // WIRE_ERASE
+  {3, false, false, false}, // SPLIT
+  {1, false, false, false}, // JOIN
+  {3, false, false, false}, // TRUNCATE
+  {4, true,  false, false}, // REPLACE
+  {0, false, false, true},  // WIRE_ERASE_HANDLE
+  {0, true,  false, false}, // WIRE_ERASE_BATCH
+};
+
+//
+// Sum and difference modulo 2^64, deltas of far apart values
+// and of malformed traces wrap around instead of overflowing
+//
+inline constexpr std::int64_t wrap(std::int64_t a, std::int64_t b) noexcept
+{
+  return static_cast<std::int64_t>(static_cast<std::uint64_t>(a) + static_cast<std::uint64_t>(b));
+}
+
+inline constexpr std::int64_t delta(std::int64_t a, std::int64_t b) noexcept
+{
+  return static_cast<std::int64_t>(static_cast<std::uint64_t>(a) - static_cast<std::uint64_t>(b));
+}
+
+template<typename T>
+struct Event
+{
+  Op op;
+  std::vector<std::pair<T,T>> cells;
+  std::vector<std::pair<T,T>> path;
+  T id;
+  std::pair<std::uint32_t,std::uint32_t> handle;
+};
+
+//
+// Algorithm's Description:
+//   Compact binary log of the operations on a set of
+//   containers. Each operation is a byte, followed by its
+//   cells and id as zigzag varints; cells are stored as the
+//   difference to the previous cell of the trace, and ids as
+//   the difference to the previous id, so local edits and
+//   wires, whose steps are a single cell, take about one byte
+//   per coordinate.
+//   Traces hold no other information than coordinates and ids,
+//   anonymize() further hides the position of the layout and
+//   the ids given by the application. Wires erased by handle
+//   are recorded by the slot and generation of the handle, and
+//   a batch erase as a single operation, so a replay from the
+//   same state erases the same wires among those sharing their
+//   endpoints. The header of a file
+//   keeps the width of the coordinates, so a replay can pick
+//   the type they were recorded with.
+//
+// Cavefeats:
+//   A trace must not be shared between threads; and records
+//   are only complete after the last field of an operation is
+//   written. Traces may come from outside of the application,
+//   decoding stops at the first malformed record.
+//
+class Trace
+{
+  private:
+  // Private Members
+    std::vector<std::uint8_t> buffer;
+    std::size_t events;
+    std::int64_t x, y, last;
+    std::uint8_t coordinates;
+    static constexpr char MAGIC[] {'E','L','T','R'};
+    static constexpr std::uint8_t VERSION {3};
+  public:
+  // Constructors
+    Trace() noexcept;
+  // Public Methods
+    // Capacity
+    std::size_t size() const noexcept;
+    std::size_t bytes() const noexcept;
+    std::size_t width() const noexcept;
+    // Modifiers
+    Trace& op(Op op) noexcept;
+    template<typename T>
+    Trace& cell(std::pair<T,T> const& cell) noexcept;
+    template<typename InIt>
+    Trace& cells(InIt it_beg, InIt it_end) noexcept;
+    template<typename T>
+    Trace& id(T id) noexcept;
+    Trace& handle(std::uint32_t index, std::uint32_t generation) noexcept;
+    void clear() noexcept;
+    // Operations
+    template<typename T, typename F>
+    std::size_t for_each(F&& f) const noexcept;
+    Trace anonymize() const noexcept;
+    template<typename U>
+    void write(U&& path) const noexcept;
+    template<typename U>
+    void read(U&& path) noexcept;
+  private:
+  // Private Methods
+    void put(std::uint64_t v) noexcept;
+    void put_signed(std::int64_t v) noexcept;
+};
+
+//
+// Constructors
+//
+inline Trace::Trace() noexcept
+  : events(0)
+  , x(0)
+  , y(0)
+  , last(0)
+  , coordinates(0)
+{
+}
+
+//
+// Public Methods
+//
+inline std::size_t Trace::size() const noexcept
+{
+  return this->events;
+}
+
+inline std::size_t Trace::bytes() const noexcept
+{
+  return this->buffer.size();
+}
+
+inline std::size_t Trace::width() const noexcept
+{
+  // Bytes of the widest coordinate recorded, zero without cells
+  return this->coordinates;
+}
+
+inline Trace& Trace::op(Op op) noexcept
+{
+  this->buffer.push_back(static_cast<std::uint8_t>(op));
+  ++this->events;
+  return *this;
+}
+
+template<typename T>
+Trace& Trace::cell(std::pair<T,T> const& cell) noexcept
+{
+  this->coordinates = std::max(this->coordinates, static_cast<std::uint8_t>(sizeof(T)));
+  this->put_signed(delta(static_cast<std::int64_t>(cell.first), this->x));
+  this->put_signed(delta(static_cast<std::int64_t>(cell.second), this->y));
+  this->x = static_cast<std::int64_t>(cell.first);
+  this->y = static_cast<std::int64_t>(cell.second);
+  return *this;
+}
+
+template<typename InIt>
+Trace& Trace::cells(InIt it_beg, InIt it_end) noexcept
+{
+  this->put(static_cast<std::uint64_t>(std::distance(it_beg, it_end)));
+  for( auto it{it_beg}; it != it_end; ++it ) this->cell(*it);
+  return *this;
+}
+
+template<typename T>
+Trace& Trace::id(T id) noexcept
+{
+  this->put_signed(delta(static_cast<std::int64_t>(id), this->last));
+  this->last = static_cast<std::int64_t>(id);
+  return *this;
+}
+
+inline Trace& Trace::handle(std::uint32_t index, std::uint32_t generation) noexcept
+{
+  // Handles are opaque, neither is a difference to the last one
+  this->put(index);
+  this->put(generation);
+  return *this;
+}
+
+inline void Trace::clear() noexcept
+{
+  *this = Trace{};
+}
+
+//
+// Operations
+//
+template<typename T, typename F>
+std::size_t Trace::for_each(F&& f) const noexcept
+{
+  //
+  // A single event is reused, so its cells are only
+  // allocated while they grow; returns the bytes of the
+  // complete records, the ones given to f
+  //
+  Event<T> event {};
+  std::int64_t x {0}, y {0}, last {0};
+  std::size_t pos {0};
+  bool valid {true};
+
+  //
+  // Varints longer than 64 bits, or cut by the end of the
+  // buffer, invalidate the rest of it
+  //
+  auto get = [&]
+  {
+    std::uint64_t v {0};
+    for( unsigned shift{0}; shift <= 63 && pos < this->buffer.size(); shift += 7 )
+    {
+      auto byte { this->buffer[pos++] };
+      v |= std::uint64_t{byte & 0x7Fu} << shift;
+      if( ! (byte & 0x80u) ) return v;
+    }
+    valid = false;
+    pos = this->buffer.size();
+    return v;
+  };
+  auto get_signed = [&]
+  {
+    auto v { get() };
+    return static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1);
+  };
+  auto get_cell = [&]
+  {
+    x = wrap(x, get_signed());
+    y = wrap(y, get_signed());
+    return std::pair<T,T>{static_cast<T>(x), static_cast<T>(y)};
+  };
+
+  std::size_t complete {0};
+  while( pos < this->buffer.size() )
+  {
+    auto op { this->buffer[pos++] };
+    if( op >= std::size(shapes) ) break;
+
+    auto const& shape { shapes[op] };
+    event.op = static_cast<Op>(op);
+    event.cells.clear();
+    event.path.clear();
+
+    for( std::uint8_t k{0}; k < shape.cells; ++k ) event.cells.push_back(get_cell());
+    if( shape.list )
+    {
+      auto n { get() };
+      for( ; n > 0 && pos < this->buffer.size(); --n ) event.path.push_back(get_cell());
+      if( n > 0 ) valid = false;
+    }
+    if( shape.id )
+    {
+      last = wrap(last, get_signed());
+      event.id = static_cast<T>(last);
+    }
+    if( shape.handle )
+    {
+      event.handle.first = static_cast<std::uint32_t>(get());
+      event.handle.second = static_cast<std::uint32_t>(get());
+    }
+
+    if( ! valid ) break;
+    complete = pos;
+    f(static_cast<Event<T> const&>(event));
+  }
+
+  return complete;
+}
+
+inline Trace Trace::anonymize() const noexcept
+{
+  //
+  // Cells are moved so that the first one is the origin, and
+  // ids are renumbered in the order they first show up
+  //
+  Trace trace;
+  std::optional<std::pair<std::int64_t,std::int64_t>> origin;
+  std::map<std::int64_t,std::int64_t> ids;
+
+  auto moved = [&](auto const& cell)
+  {
+    if( ! origin ) origin = cell;
+    return std::pair<std::int64_t,std::int64_t>{delta(cell.first, origin->first),
+      delta(cell.second, origin->second)};
+  };
+
+  this->for_each<std::int64_t>([&](auto const& event)
+  {
+    trace.op(event.op);
+    for( auto const& cell : event.cells ) trace.cell(moved(cell));
+    if( shapes[static_cast<std::size_t>(event.op)].list )
+    {
+      trace.put(event.path.size());
+      for( auto const& cell : event.path ) trace.cell(moved(cell));
+    }
+    if( shapes[static_cast<std::size_t>(event.op)].id )
+    {
+      trace.id(ids.emplace(event.id, static_cast<std::int64_t>(ids.size())).first->second);
+    }
+    if( shapes[static_cast<std::size_t>(event.op)].handle )
+    {
+      trace.handle(event.handle.first, event.handle.second);
+    }
+  });
+
+  // Cells are decoded as 64 bits, the recorded width is kept
+  trace.coordinates = this->coordinates;
+  return trace;
+}
+
+template<typename U>
+void Trace::write(U&& path) const noexcept
+{
+  std::ofstream os{std::forward<U>(path), std::ios::binary};
+
+  if( ! os.good() ) return;
+
+  os.write(MAGIC, sizeof(MAGIC));
+  os.put(static_cast<char>(VERSION));
+  os.put(static_cast<char>(this->coordinates));
+  os.write(reinterpret_cast<char const*>(this->buffer.data()),
+    static_cast<std::streamsize>(this->buffer.size()));
+}
+
+template<typename U>
+void Trace::read(U&& path) noexcept
+{
+  //
+  // Traces are read back in full, the state of the writer is
+  // restored by decoding them once; a malformed tail is cut,
+  // so appended records follow the last complete one
+  //
+  this->clear();
+
+  std::ifstream is{std::forward<U>(path), std::ios::binary};
+  if( ! is.good() ) return;
+
+  char header[sizeof(MAGIC) + 2] {};
+  if( ! is.read(header, sizeof(header)) ) return;
+  if( ! std::equal(std::begin(MAGIC), std::end(MAGIC), header) ) return;
+  if( static_cast<std::uint8_t>(header[sizeof(MAGIC)]) != VERSION ) return;
+
+  this->buffer.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+
+  auto complete { this->for_each<std::int64_t>([&](auto const& event)
+  {
+    ++this->events;
+    auto const& cells { event.path.empty() ? event.cells : event.path };
+    if( ! cells.empty() ) std::tie(this->x, this->y) = cells.back();
+    if( shapes[static_cast<std::size_t>(event.op)].id ) this->last = event.id;
+  }) };
+  this->buffer.resize(complete);
+  this->coordinates = static_cast<std::uint8_t>(header[sizeof(MAGIC) + 1]);
+}
+
+//
+// Private Methods
+//
+inline void Trace::put(std::uint64_t v) noexcept
+{
+  while( v >= 0x80 )
+  {
+    this->buffer.push_back(static_cast<std::uint8_t>(v | 0x80));
+    v >>= 7;
+  }
+  this->buffer.push_back(static_cast<std::uint8_t>(v));
+}
+
+inline void Trace::put_signed(std::int64_t v) noexcept
+{
+  this->put((static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63));
+}
+
+//
+// Runs the operation of an event on containers with the
+// interface of Placements and Wires; the result of lookups
+// is returned, so that they are not optimized away
+//
+template<template<typename> typename P, template<typename> typename W, typename T>
+std::int64_t apply(Event<T> const& event, P<T>& placements, W<T>& wires) noexcept
+{
+  auto const& c { event.cells };
+
+  switch (event.op)
+  {
+    case Op::AT:
+      return placements.at(c[0]).value_or(-1);
+    case Op::FIND:
+      return placements.find(event.id).has_value();
+    case Op::INSERT:
+      placements.insert(std::make_pair(c[0], event.id));
+      break;
+    case Op::ERASE:
+      placements.erase(event.id);
+      break;
+    case Op::WIRE_FIND:
+      return wires.find(c[0], c[1]).has_value();
+    case Op::WIRE_INSERT:
+      wires.insert(event.path);
+      break;
+    case Op::WIRE_ERASE:
+      wires.erase(c[0], c[1]);
+      break;
+    case Op::SPLIT:
+      return wires.split(c[0], c[1], c[2]);
+    case Op::JOIN:
+      return wires.join(c[0]);
+    case Op::TRUNCATE:
+      return wires.truncate(c[0], c[1], c[2]);
+    case Op::REPLACE:
+      return wires.replace(c[0], c[1], c[2], c[3], event.path);
+    case Op::WIRE_ERASE_HANDLE:
+      return wires.erase({event.handle.first, event.handle.second});
+    case Op::WIRE_ERASE_BATCH:
+    {
+      // The path holds the endpoints of each wire in turn
+      std::vector<std::pair<std::pair<T,T>,std::pair<T,T>>> endpoints;
+      for( std::size_t k{0}; k + 1 < event.path.size(); k += 2 )
+      {
+        endpoints.emplace_back(event.path[k], event.path[k+1]);
+      }
+      wires.erase(endpoints.cbegin(), endpoints.cend());
+      break;
+    }
+  }
+
+  return 0;
+}
+
+template<template<typename> typename P, template<typename> typename W, typename T>
+std::int64_t replay(Trace const& trace, P<T>& placements, W<T>& wires) noexcept
+{
+  std::int64_t result {0};
+  trace.for_each<T>([&](auto const& event) { result += apply(event, placements, wires); });
+  return result;
+}
+
+} // namespace electra::trace
@@ -10,7 +10,11 @@
 
 #pragma once
 
+#include <utility>
 #include <iterator>
+#include <vector>
+
+#include <electra/instrument.hpp>
 
 namespace electra::wire::const_iterator
 {
@@ -18,13 +22,15 @@ namespace electra::wire::const_iterator
 //
 // Forward const iterator
 //
-template<typename T1, typename InIt, typename T2 = typename InIt::value_type>
+template<typename T1, typename InIt,
+  typename T2 = std::vector<typename InIt::value_type::value_type>>
 class const_iterator {
   private:
   // Private Members
     T1 const& wires;
     InIt current;
     T2 decoded_cache;
+    instrument::Counters counters {nullptr};
   public:
   // Public Members
     using iterator_tag = std::input_iterator_tag;
@@ -33,7 +39,8 @@ class const_iterator {
     using const_reference = T1 const &;
   // Constructors
     const_iterator() = default;
-    const_iterator(T1 const& wires, InIt current);
+    const_iterator(T1 const& wires, InIt current,
+      instrument::Counters counters = instrument::Counters{nullptr});
   // Operators
     InIt const& operator++();
     T2 const& operator*();
@@ -46,10 +53,12 @@ class const_iterator {
 // Constructors
 //
 template<typename T1, typename InIt, typename T2>
-const_iterator<T1,InIt,T2>::const_iterator(T1 const& wires, InIt current)
+const_iterator<T1,InIt,T2>::const_iterator(T1 const& wires, InIt current,
+  instrument::Counters counters)
   : wires(wires)
   , current(current)
   , decoded_cache(T2{})
+  , counters(std::move(counters))
 {
 }
 
@@ -66,7 +75,14 @@ InIt const& const_iterator<T1,InIt,T2>::operator++()
 template<typename T1, typename InIt, typename T2>
 T2 const& const_iterator<T1,InIt,T2>::operator*()
 {
-  this->decoded_cache = wire::decode(this->current->cbegin(), this->current->cend());
+  //
+  // The buffer is reused, it only grows along the iteration
+  //
+  this->decoded_cache.clear();
+  wire::decode_into(this->current->cbegin(), this->current->cend(),
+    std::back_inserter(this->decoded_cache));
+  this->counters.count(&instrument::Stats::decodes);
+  this->counters.count(&instrument::Stats::cells, this->decoded_cache.size());
   return this->decoded_cache;
 }
 
@@ -10,8 +10,15 @@
 
 #pragma once
 
+#include <array>
 #include <vector>
+#include <memory>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <type_traits>
 #include <electra/wire/traits.hpp>
+#include <electra/wire/encode.hpp>
 
 namespace electra::wire
 {
@@ -23,12 +30,92 @@ namespace electra::wire
 //   {{0,1},{0,2},{0,3},{0,4},{0,5}}
 //   Where the second pair indicates the direction for which
 //   the list must be expanded to reach the original size.
+//   Elements are written to the output iterator, which is
+//   returned past the last one written.
 // Cavefeats:
 //   A list must change only one of its pair elements
 //   at a time, sequentially, else the behaviour is undefined
 //
+template<typename InIt, typename OutIt>
+constexpr OutIt decode_into( InIt it_beg, InIt it_end, OutIt out )
+{
+  if( it_beg == it_end ) return out;
+
+  auto cell { *it_beg };
+  *out = cell; ++out;
+
+  //
+  // Each segment is a direction followed by its end point
+  // (0,3),(0,1),(0,8),(1,0),(5,8)
+  //    ^     ^     ^
+  //  cell   dir  target
+  //
+  for( auto it{std::next(it_beg)}; it != it_end; )
+  {
+    auto dir { *it };
+    if( ++it == it_end ) break;
+    auto target { *it };
+    ++it;
+
+    auto steps { (target.first - cell.first) * dir.first
+      + (target.second - cell.second) * dir.second };
+
+    for( decltype(steps) k{0}; k < steps; ++k )
+    {
+      cell.first += dir.first;
+      cell.second += dir.second;
+      *out = cell; ++out;
+    }
+  }
+
+  return out;
+}
+
+//
+// Number of elements decode_into writes for an encoded list,
+// in O(segments)
+//
 template<typename InIt>
-auto decode( InIt&& it_beg, InIt&& it_end )
+constexpr std::size_t decoded_size( InIt it_beg, InIt it_end )
+{
+  if( it_beg == it_end ) return 0;
+
+  std::size_t size {1};
+  auto cell { *it_beg };
+
+  for( auto it{std::next(it_beg)}; it != it_end; )
+  {
+    if( ++it == it_end ) break;
+    auto target { *it };
+    ++it;
+
+    auto dx { target.first - cell.first };
+    auto dy { target.second - cell.second };
+    size += static_cast<std::size_t>(dx < 0 ? -dx : dx) + static_cast<std::size_t>(dy < 0 ? -dy : dy);
+    cell.first = target.first;
+    cell.second = target.second;
+  }
+
+  return size;
+}
+
+//
+// Decodes a contiguous range into a caller buffer, such as a
+// std::span, returning the number of elements written, or
+// std::nullopt when the buffer is too small
+//
+template<typename R, typename B>
+std::optional<std::size_t> decode_into( R const& range, B&& buffer )
+{
+  auto size { decoded_size(std::cbegin(range), std::cend(range)) };
+  if( size > std::size(buffer) ) return std::nullopt;
+  decode_into(std::cbegin(range), std::cend(range), std::data(buffer));
+  return size;
+}
+
+template<typename InIt, typename Alloc = std::allocator<
+  typename std::iterator_traits<std::decay_t<InIt>>::value_type>>
+auto decode( InIt&& it_beg, InIt&& it_end, Alloc const& alloc = Alloc{} )
 {
   //
   // Check for traits
@@ -48,117 +135,36 @@ auto decode( InIt&& it_beg, InIt&& it_end )
   using T = typename InIt::value_type;
 
   //
-  // Define the directions enumeration
+  // The list is built with the given allocator, rebound
+  // to the element type, and sized beforehand
   //
-  enum class Direction
-  {
-    UP,
-    DOWN,
-    LEFT,
-    RIGHT,
-  };
+  using A = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+  std::vector<T,A> list{A(alloc)};
 
-  std::vector<T> list;
-
-  //
-  // If the list has size 1, return its only element
-  //
-  if( it_beg == it_end-1 )
-  {
-    list.push_back(*it_beg);
-    return list;
-  }
-
-  //
-  // Iterate through the list
-  //
-  bool first{true};
-  for( auto it{it_beg}; it!=it_end; )
-  {
-    Direction dir;
-
-    //
-    // Discover the direction of the wire
-    //
-    if( (it+1)->first == 0 )
-    {
-      if( (it+1)->second == 1 )
-      {
-        dir = Direction::DOWN;
-      }
-      else
-      {
-        dir = Direction::UP;
-      }
-
-    }
-    else
-    {
-      if( (it+1)->first == 1 )
-      {
-        dir = Direction::RIGHT;
-      }
-      else
-      {
-        dir = Direction::LEFT;
-      }
-    }
-
-    auto i{ it->first };
-    auto j{ it->second };
-
-    switch (dir)
-    {
-      case Direction::RIGHT:
-        if( ! first ) ++i;
-        for(; i != (it+2)->first+1; ++i )
-        {
-          list.emplace_back( i, j );
-        }
-        break;
-      case Direction::LEFT:
-        if( ! first ) --i;
-        for(; i != (it+2)->first-1; --i )
-        {
-          list.emplace_back( i, j );
-        }
-        break;
-      case Direction::DOWN:
-        if( ! first ) ++j;
-        for(; j != (it+2)->second+1; ++j )
-        {
-          list.emplace_back( i, j );
-        }
-        break;
-      default:
-        if( ! first ) --j;
-        for(; j != (it+2)->second-1; --j )
-        {
-          list.emplace_back( i, j );
-        }
-    }
-
-    //
-    // Format of the wire is assumed
-    // to be consistent, next (it+2) comes a
-    // starting point, a direction and
-    // an ending point
-    // (0,3),(0,1),(0,8),(1,0),(5,8)
-    //    ^           ^           ^
-    //   it        (it+2)      (it+4)
-    //
-    if( it+3 == it_end )
-    {
-      it = it_end;
-    }
-    else
-    {
-      it = it+2;
-    }
-    first = false;
-  }
+  list.reserve(decoded_size(it_beg, it_end));
+  decode_into(it_beg, it_end, std::back_inserter(list));
 
   return list;
 }
 
+//
+// Decodes a std::array in a constant expression, N must be
+// the decoded size of the array, see decoded below
+//
+template<std::size_t N, typename P, std::size_t M>
+constexpr std::array<P,N> decode( std::array<P,M> const& list )
+{
+  std::array<P,N> cells {};
+  decode_into(list.cbegin(), list.cend(), Slots<P>{cells.data()});
+  return cells;
+}
+
+//
+// Decoded form of an encoded std::array with static storage,
+// computed at compile time
+//
+template<auto const& list>
+inline constexpr auto decoded
+  { decode<decoded_size(list.cbegin(), list.cend())>(list) };
+
 } // namespace electra::wire
@@ -0,0 +1,219 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : edit
+// @created     : Monday Oct 19, 2026 09:12:40 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <cstddef>
+
+namespace electra::wire::edit
+{
+
+//
+// Algorithm's Description:
+//   Operations in this file work directly on encoded wires, as
+//   produced by encode, without expanding them. An encoded wire
+//   is laid out as:
+//   (0,3),(0,1),(0,8),(1,0),(5,8)
+//     ^     ^     ^     ^     ^
+//   start  dir  point  dir  point
+//   Points live at even indexes, directions at odd indexes; each
+//   (point,dir,point) triple is a straight segment.
+// Cavefeats:
+//   The wires must be valid encodings, else the behaviour is
+//   undefined
+//
+
+//
+// Number of steps taken from a in direction d to reach c,
+// or nullopt if c does not lie in the direction d from a
+//
+template<typename P, typename D>
+std::optional<std::ptrdiff_t> steps(P const& a, D const& d, P const& c) noexcept
+{
+  if( d.first == 0 )
+  {
+    if( c.first != a.first ) return std::nullopt;
+    return static_cast<std::ptrdiff_t>((c.second - a.second) * d.second);
+  }
+  if( c.second != a.second ) return std::nullopt;
+  return static_cast<std::ptrdiff_t>((c.first - a.first) * d.first);
+}
+
+//
+// Position of a cell in an encoded wire; first is the index of
+// the point starting the segment which holds the cell, second is
+// the number of steps taken from that point
+//
+template<typename W, typename P>
+std::optional<std::pair<std::size_t,std::ptrdiff_t>> locate(W const& w,
+  P const& c) noexcept
+{
+  if( w.empty() ) return std::nullopt;
+  if( w.front() == c ) return std::make_pair(std::size_t{0}, std::ptrdiff_t{0});
+
+  for( std::size_t k{0}; k+2 < w.size(); k += 2 )
+  {
+    auto s { steps(w[k], w[k+1], c) };
+    auto l { steps(w[k], w[k+1], w[k+2]) };
+    if( s && *s > 0 && *s <= *l ) return std::make_pair(k, *s);
+  }
+
+  return std::nullopt;
+}
+
+//
+// Reverses the traversal order of an encoded wire
+//
+template<typename W>
+W reverse(W const& w)
+{
+  W r(w.get_allocator());
+  r.reserve(w.size());
+
+  for( auto it{w.rbegin()}; it != w.rend(); ++it )
+  {
+    r.push_back(*it);
+  }
+
+  for( std::size_t k{1}; k < r.size(); k += 2 )
+  {
+    r[k].first = -r[k].first;
+    r[k].second = -r[k].second;
+  }
+
+  return r;
+}
+
+//
+// Splits the wire at the cell c; both halves keep c as an
+// endpoint, the first ends and the second starts in it
+//
+template<typename W, typename P>
+std::optional<std::pair<W,W>> split(W const& w, P const& c)
+{
+  auto pos { locate(w, c) };
+
+  if( ! pos ) return std::nullopt;
+
+  W head(w.get_allocator());
+  W tail(w.get_allocator());
+
+  if( pos->second == 0 )
+  {
+    head.push_back(c);
+    tail = w;
+    return std::make_pair(std::move(head), std::move(tail));
+  }
+
+  auto k { pos->first };
+
+  head.reserve(k+3);
+  head.insert(head.end(), w.begin(), w.begin()+k+2);
+  head.push_back(c);
+
+  tail.reserve(w.size()-k);
+  tail.push_back(c);
+  if( c != w[k+2] )
+  {
+    tail.push_back(w[k+1]);
+    tail.push_back(w[k+2]);
+  }
+  tail.insert(tail.end(), w.begin()+k+3, w.end());
+
+  return std::make_pair(std::move(head), std::move(tail));
+}
+
+//
+// Joins b at the end of a; the last point of a must be the first
+// point of b. Segments that continue in the same direction are
+// merged, segments that turn back over themselves are rejected
+//
+template<typename W>
+std::optional<W> join(W const& a, W const& b)
+{
+  if( a.empty() || b.empty() || a.back() != b.front() ) return std::nullopt;
+
+  if( a.size() == 1 ) return b;
+  if( b.size() == 1 ) return a;
+
+  auto const& da { a[a.size()-2] };
+  auto const& db { b[1] };
+
+  if( da.first == -db.first && da.second == -db.second ) return std::nullopt;
+
+  W r(a.get_allocator());
+  r.reserve(a.size()+b.size());
+  r.insert(r.end(), a.begin(), a.end());
+
+  if( da == db )
+  {
+    r.pop_back();
+    r.insert(r.end(), b.begin()+2, b.end());
+  }
+  else
+  {
+    r.insert(r.end(), b.begin()+1, b.end());
+  }
+
+  return r;
+}
+
+//
+// Keeps the wire from its first point up to the cell c
+//
+template<typename W, typename P>
+std::optional<W> truncate(W const& w, P const& c)
+{
+  auto parts { split(w, c) };
+  if( ! parts ) return std::nullopt;
+  return std::move(parts->first);
+}
+
+//
+// Replaces the sub-wire between the cells from and to by the
+// encoded wire e, which must start in from and end in to.
+// The cell from must come before the cell to in the wire
+//
+template<typename W, typename P>
+std::optional<W> replace(W const& w, P const& from, P const& to, W const& e)
+{
+  if( e.empty() || e.front() != from || e.back() != to ) return std::nullopt;
+
+  auto first { split(w, from) };
+  if( ! first ) return std::nullopt;
+
+  auto second { split(first->second, to) };
+  if( ! second ) return std::nullopt;
+
+  auto head { join(first->first, e) };
+  if( ! head ) return std::nullopt;
+
+  return join(*head, second->second);
+}
+
+//
+// Extracts the sub-wire between the cells from and to, which
+// must appear in this order in the wire
+//
+template<typename W, typename P>
+std::optional<W> slice(W const& w, P const& from, P const& to)
+{
+  auto first { split(w, from) };
+  if( ! first ) return std::nullopt;
+
+  auto second { split(first->second, to) };
+  if( ! second ) return std::nullopt;
+
+  return std::move(second->first);
+}
+
+} // namespace electra::wire::edit
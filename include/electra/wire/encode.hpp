@@ -10,12 +10,58 @@
 
 #pragma once
 
+#include <array>
 #include <vector>
+#include <memory>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <type_traits>
 #include <electra/wire/traits.hpp>
 
 namespace electra::wire
 {
 
+//
+// Output iterator which only counts the elements written
+//
+struct Counter
+{
+  using iterator_category = std::output_iterator_tag;
+  using value_type = void;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = void;
+  std::size_t n {0};
+  constexpr Counter& operator*() noexcept { return *this; }
+  constexpr Counter& operator++() noexcept { ++this->n; return *this; }
+  template<typename U>
+  constexpr Counter& operator=(U const&) noexcept { return *this; }
+};
+
+//
+// Output iterator writing pairs member by member, std::pair
+// assignment is only usable in constant expressions since C++20
+//
+template<typename P>
+struct Slots
+{
+  using iterator_category = std::output_iterator_tag;
+  using value_type = void;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = void;
+  P* p;
+  constexpr Slots& operator*() noexcept { return *this; }
+  constexpr Slots& operator++() noexcept { ++this->p; return *this; }
+  constexpr Slots& operator=(P const& u) noexcept
+  {
+    this->p->first = u.first;
+    this->p->second = u.second;
+    return *this;
+  }
+};
+
 //
 // Algorithm's Description:
 //   Reduce a list length using directional separators. E.g:
@@ -23,12 +69,87 @@ namespace electra::wire
 //   {{0,1},{0,1},{0,5}}
 //   Where the second pair indicates the direction for which
 //   the list must be expanded to reach the original size.
+//   Elements are written to the output iterator in a single
+//   pass, which is returned past the last one written.
 // Cavefeats:
 //   A list must change only one of its pair elements
-//   at a time, sequentially, else the behaviour is undefined
+//   at a time, sequentially, else the behaviour is undefined.
+//   Repeated consecutive elements are written once
+//
+template<typename InIt, typename OutIt>
+constexpr OutIt encode_into( InIt it_beg, InIt it_end, OutIt out )
+{
+  using P = typename std::iterator_traits<InIt>::value_type;
+  using T = std::decay_t<decltype(std::declval<P>().first)>;
+
+  if( it_beg == it_end ) return out;
+
+  auto sign = [](T t) { return static_cast<T>((T{0} < t) - (t < T{0})); };
+
+  //
+  // The last element is kept as an iterator and the direction
+  // as its components, so no pair is assigned to
+  //
+  InIt last { it_beg };
+  T dx {0}, dy {0};
+
+  *out = *last; ++out;
+
+  for( auto it{std::next(it_beg)}; it != it_end; ++it )
+  {
+    if( *it == *last ) continue;
+
+    T nx { sign((*it).first - (*last).first) };
+    T ny { sign((*it).second - (*last).second) };
+
+    //
+    // A turn closes the current segment at its last element
+    //
+    if( (dx != 0 || dy != 0) && (nx != dx || ny != dy) )
+    {
+      *out = P{dx, dy}; ++out;
+      *out = *last; ++out;
+    }
+
+    dx = nx; dy = ny;
+    last = it;
+  }
+
+  if( dx != 0 || dy != 0 )
+  {
+    *out = P{dx, dy}; ++out;
+    *out = *last; ++out;
+  }
+
+  return out;
+}
+
+//
+// Number of elements encode_into writes for a list
 //
 template<typename InIt>
-auto encode( InIt&& it_beg, InIt&& it_end )
+constexpr std::size_t encoded_size( InIt it_beg, InIt it_end )
+{
+  return encode_into(it_beg, it_end, Counter{}).n;
+}
+
+//
+// Encodes a contiguous range into a caller buffer, such as a
+// std::span, returning the number of elements written, or
+// std::nullopt when the buffer is too small
+//
+template<typename R, typename B>
+std::optional<std::size_t> encode_into( R const& range, B&& buffer )
+{
+  auto size { encoded_size(std::cbegin(range), std::cend(range)) };
+  if( size > std::size(buffer) ) return std::nullopt;
+  encode_into(std::cbegin(range), std::cend(range), std::data(buffer));
+  return size;
+}
+
+template<typename InIt, typename Alloc = std::allocator<
+  typename std::iterator_traits<std::decay_t<InIt>>::value_type>>
+auto encode( InIt&& it_beg, InIt&& it_end, Alloc const& alloc = Alloc{} )
 {
   //
   // Check for traits
@@ -48,189 +169,38 @@ auto encode( InIt&& it_beg, InIt&& it_end )
   using T = typename InIt::value_type;
 
   //
-  // Define the directions enumeration
+  // The list is built with the given allocator, rebound
+  // to the element type, and sized beforehand
   //
-  enum class Direction
-  {
-    UP,
-    DOWN,
-    LEFT,
-    RIGHT,
-  };
+  using A = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+  std::vector<T,A> list{A(alloc)};
 
-  std::vector<T> list;
+  list.reserve(encoded_size(it_beg, it_end));
+  encode_into(it_beg, it_end, std::back_inserter(list));
 
-  //
-  // If the list has size 1, return its only element
-  //
-  if( it_beg == it_end-1 )
-  {
-    list.push_back(*it_beg);
-    return list;
-  }
-
-  //
-  // Iterate through the list
-  //
-  bool first{true};
-  for( auto it{it_beg}; it!=it_end; )
-  {
-    Direction dir;
-
-    //
-    // The first element of the item
-    // is equal to the one of its
-    // sucessor.
-    //
-    if( it->first == (it+1)->first )
-    {
-      if( it->second < (it+1)->second )
-      {
-        dir = Direction::DOWN;
-      }
-      else
-      {
-        dir = Direction::UP;
-      }
-
-      //
-      // Advance until an element is found
-      // such that its first element is not
-      // equal to the one of its predecessor
-      //
-      do
-      {
-        if( it == it_end )
-        {
-          break;
-        }
-        else
-        {
-          ++it;
-        }
-      }
-      while(it->first == (it+1)->first);
-
-      //
-      // Given a position, indicate the direction
-      // in which the list must be expanded to
-      // obtain the original one
-      //
-      if( dir == Direction::UP )
-      {
-        if( first )
-        {
-          list.emplace_back( *it_beg );
-        }
-
-        list.emplace_back( 0, -1 );
-
-        if( it == it_end )
-        {
-          list.emplace_back( *(it-1) );
-        }
-        else
-        {
-          list.emplace_back( *it );
-        }
-      }
-      else
-      {
-        if( first )
-        {
-          list.push_back( *it_beg );
-        }
-
-        list.emplace_back( 0, 1 );
-
-        if( it == it_end )
-        {
-          list.push_back( *(it-1) );
-        }
-        else
-        {
-          list.push_back( *it );
-        }
-      }
-    }
-
-    //
-    // The second element of the item
-    // is equal to the second element
-    // of its sucessor.
-    //
-    else
-    {
-      if( it->first < (it+1)->first )
-      {
-        dir = Direction::RIGHT;
-      }
-      else
-      {
-        dir = Direction::LEFT;
-      }
-
-      do
-      {
-        if( it == it_end )
-        {
-          break;
-        }
-        else
-        {
-          ++it;
-        }
-      }
-      while( it->second == (it+1)->second );
-
-      if( dir == Direction::LEFT )
-      {
-        if( first )
-        {
-          list.emplace_back( *it_beg );
-        }
-
-        list.emplace_back( -1, 0 );
-
-        if( it == it_end )
-        {
-          list.emplace_back( *(it-1) );
-        }
-        else
-        {
-          list.emplace_back( *it );
-        }
-      }
-      else
-      {
-        if( first )
-        {
-          list.push_back( *it_beg );
-        }
-
-        list.emplace_back( 1, 0 );
-
-        if( it == it_end )
-        {
-          list.push_back( *(it-1) );
-        }
-        else
-        {
-          list.push_back( *it );
-        }
-      }
-    }
-
-    //
-    // Move to process the next coordinate of the list
-    // if it is not unidirectional in one of its
-    // elements
-    //
-    if( it+1 == it_end ) it = it_end;
-    first = false;
-  }
+  return list;
+}
 
+//
+// Encodes a std::array in a constant expression, N must be
+// the encoded size of the array, see encoded below
+//
+template<std::size_t N, typename P, std::size_t M>
+constexpr std::array<P,N> encode( std::array<P,M> const& cells )
+{
+  std::array<P,N> list {};
+  encode_into(cells.cbegin(), cells.cend(), Slots<P>{list.data()});
   return list;
 }
 
+//
+// Encoded form of a std::array with static storage, computed
+// at compile time. E.g:
+//   constexpr std::array<std::pair<int,int>,3> w {{{0,0},{1,0},{2,0}}};
+//   constexpr auto e { encoded<w> };
+//
+template<auto const& cells>
+inline constexpr auto encoded
+  { encode<encoded_size(cells.cbegin(), cells.cend())>(cells) };
+
 } // namespace electra::wire
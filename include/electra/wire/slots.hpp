@@ -0,0 +1,217 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : slots
+// @created     : Friday Oct 30, 2026 15:26:03 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <memory_resource>
+
+#include <electra/memory.hpp>
+
+namespace electra::wire::slots
+{
+
+inline constexpr std::uint32_t NONE { std::numeric_limits<std::uint32_t>::max() };
+
+//
+// Stable reference to a wire: the slot it was given and the
+// generation of the slot at that time. Erasing the wire bumps
+// the generation, so older handles to the slot go stale
+//
+struct Handle
+{
+  std::uint32_t index {NONE};
+  std::uint32_t generation {0};
+
+  bool operator==(Handle const& rhs) const noexcept
+  {
+    return this->index == rhs.index && this->generation == rhs.generation;
+  }
+  bool operator!=(Handle const& rhs) const noexcept
+  {
+    return ! this->operator==(rhs);
+  }
+};
+
+//
+// Algorithm's Description:
+//   Slot map over a dense list, which the owner keeps. Each
+//   slot holds the position of its element in the list, and
+//   each position the slot that owns it; free slots are linked
+//   through their position field, the last freed one first.
+//   Elements are erased by moving the last one in their place,
+//   so lookups and erasures are O(1) and the list stays dense.
+//
+// Cavefeats:
+//   The owner must mirror every change of the list: push for
+//   appended elements, erase for the swap with the last one,
+//   and move and resize for compactions.
+//
+class Slots
+{
+  private:
+  // Private Types
+    struct Slot
+    {
+      std::uint32_t position;
+      std::uint32_t generation;
+    };
+  // Private Members
+    std::pmr::vector<Slot> slots;
+    std::pmr::vector<std::uint32_t> owners;
+    std::uint32_t free;
+  public:
+  // Constructors
+    explicit Slots(std::pmr::memory_resource* resource
+      = std::pmr::get_default_resource()) noexcept;
+  // Public Methods
+    // Capacity
+    std::size_t size() const noexcept;
+    memory::Usage memory_usage() const noexcept;
+    // Modifiers
+    Handle push() noexcept;
+    void erase(std::size_t position) noexcept;
+    void move(std::size_t from, std::size_t to) noexcept;
+    void resize(std::size_t size) noexcept;
+    void release(std::size_t position) noexcept;
+    template<typename F>
+    void permute(F&& from) noexcept;
+    void clear() noexcept;
+    void shrink_to_fit() noexcept;
+    // Lookup
+    std::optional<std::size_t> find(Handle const& handle) const noexcept;
+};
+
+//
+// Constructors
+//
+inline Slots::Slots(std::pmr::memory_resource* resource) noexcept
+  : slots(resource)
+  , owners(resource)
+  , free(NONE)
+{
+}
+
+//
+// Public Methods
+//
+inline std::size_t Slots::size() const noexcept
+{
+  return this->owners.size();
+}
+
+inline memory::Usage Slots::memory_usage() const noexcept
+{
+  // Slots and owners only index the list, neither is payload
+  auto usage { memory::vector(this->slots) };
+  usage += memory::vector(this->owners);
+  usage.index += usage.payload;
+  usage.payload = 0;
+  return usage;
+}
+
+inline Handle Slots::push() noexcept
+{
+  //
+  // Freed slots are reused before new ones are taken, they
+  // keep the generation given when they were freed
+  //
+  auto position { static_cast<std::uint32_t>(this->owners.size()) };
+  auto index { this->free };
+
+  if( index != NONE )
+  {
+    this->free = this->slots[index].position;
+    this->slots[index].position = position;
+  }
+  else
+  {
+    index = static_cast<std::uint32_t>(this->slots.size());
+    this->slots.push_back({position, 0});
+  }
+
+  this->owners.push_back(index);
+  return {index, this->slots[index].generation};
+}
+
+inline void Slots::erase(std::size_t position) noexcept
+{
+  // The last element takes the place of the erased one
+  this->release(position);
+  this->move(this->owners.size() - 1, position);
+  this->owners.pop_back();
+}
+
+inline void Slots::move(std::size_t from, std::size_t to) noexcept
+{
+  if( from == to ) return;
+  this->owners[to] = this->owners[from];
+  this->slots[this->owners[to]].position = static_cast<std::uint32_t>(to);
+}
+
+inline void Slots::resize(std::size_t size) noexcept
+{
+  // Positions past the size must have been released or moved
+  this->owners.resize(size);
+}
+
+inline void Slots::release(std::size_t position) noexcept
+{
+  auto index { this->owners[position] };
+  ++this->slots[index].generation;
+  this->slots[index].position = this->free;
+  this->free = index;
+}
+
+//
+// Rearranges the positions, the element at position k is the
+// one that was at from(k) before
+//
+template<typename F>
+void Slots::permute(F&& from) noexcept
+{
+  std::pmr::vector<std::uint32_t> owners(this->owners.size(), this->owners.get_allocator());
+  for( std::size_t k{0}; k < owners.size(); ++k )
+  {
+    owners[k] = this->owners[from(k)];
+    this->slots[owners[k]].position = static_cast<std::uint32_t>(k);
+  }
+  this->owners = std::move(owners);
+}
+
+inline void Slots::clear() noexcept
+{
+  // Every handle goes stale, the slots themselves are kept
+  for( std::size_t k{0}; k < this->owners.size(); ++k ) this->release(k);
+  this->owners.clear();
+}
+
+inline void Slots::shrink_to_fit() noexcept
+{
+  // Free slots are kept, their generation outlives the wires
+  this->slots.shrink_to_fit();
+  this->owners.shrink_to_fit();
+}
+
+inline std::optional<std::size_t> Slots::find(Handle const& handle) const noexcept
+{
+  if( handle.index >= this->slots.size() ) return std::nullopt;
+
+  auto const& slot { this->slots[handle.index] };
+  if( slot.generation != handle.generation ) return std::nullopt;
+
+  return slot.position;
+}
+
+} // namespace electra::wire::slots
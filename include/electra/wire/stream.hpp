@@ -0,0 +1,132 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : stream
+// @created     : Friday Oct 23, 2026 10:18:44 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+
+#include <electra/generator.hpp>
+
+#ifdef ELECTRA_COROUTINES
+
+#include <memory>
+#include <utility>
+#include <iterator>
+#include <optional>
+#include <algorithm>
+
+namespace electra::wire
+{
+
+//
+// Algorithm's Description:
+//   Cells of an encoded wire produced one at a time, without
+//   expanding the wire in memory. When a region is given, each
+//   segment is clipped against it in O(1) before any of its
+//   cells is produced, so the work done is proportional to the
+//   segments of the wire plus the cells inside the region.
+//
+
+//
+// Cells of the encoded wires in [it_beg,it_end), wire after
+// wire, only the ones inside the inclusive region when one is
+// given. The wires must outlive the generator
+//
+template<typename InIt,
+  typename P = typename std::iterator_traits<InIt>::value_type::value_type>
+generator::Generator<P> stream(InIt it_beg, InIt it_end,
+  std::optional<std::pair<P,P>> region = std::nullopt)
+{
+  using T = decltype(P{}.first);
+
+  P lo {}, hi {};
+  if( region )
+  {
+    auto const& [a, b] { *region };
+    lo = { std::min(a.first, b.first), std::min(a.second, b.second) };
+    hi = { std::max(a.first, b.first), std::max(a.second, b.second) };
+  }
+
+  //
+  // Steps t of the line s + d*t which stay within [l,h] on
+  // one axis, the whole line when it does not move on it
+  //
+  auto clip = [](T s, T d, T l, T h, T& t0, T& t1)
+  {
+    if( d == 0 )
+    {
+      if( s < l || s > h ) t1 = t0 - 1;
+      return;
+    }
+    t0 = std::max<T>(t0, d > 0 ? l - s : s - h);
+    t1 = std::min<T>(t1, d > 0 ? h - s : s - l);
+  };
+
+  for( auto wire{it_beg}; wire != it_end; ++wire )
+  {
+    if( std::empty(*wire) ) continue;
+
+    auto it { std::cbegin(*wire) };
+    P start { *it };
+
+    if( ! region || (lo.first <= start.first && start.first <= hi.first
+      && lo.second <= start.second && start.second <= hi.second) )
+    {
+      co_yield start;
+    }
+
+    for( ++it; it != std::cend(*wire) && std::next(it) != std::cend(*wire); it += 2 )
+    {
+      auto dir { *it };
+      auto target { *std::next(it) };
+
+      T t0 {1};
+      T t1 = (target.first - start.first) * dir.first
+        + (target.second - start.second) * dir.second;
+
+      if( region )
+      {
+        clip(start.first, dir.first, lo.first, hi.first, t0, t1);
+        clip(start.second, dir.second, lo.second, hi.second, t0, t1);
+      }
+
+      for( auto t{t0}; t <= t1; ++t )
+      {
+        P cell { static_cast<T>(start.first + dir.first * t),
+          static_cast<T>(start.second + dir.second * t) };
+        co_yield cell;
+      }
+
+      start = target;
+    }
+  }
+}
+
+//
+// Cells of an encoded wire, in order
+//
+template<typename W, typename P = typename W::value_type>
+generator::Generator<P> cells(W const& w)
+{
+  return stream(std::addressof(w), std::addressof(w) + 1);
+}
+
+//
+// Cells of an encoded wire inside the inclusive region with
+// corners a and b, in order
+//
+template<typename W, typename P = typename W::value_type>
+generator::Generator<P> cells(W const& w, P const& a, P const& b)
+{
+  return stream(std::addressof(w), std::addressof(w) + 1,
+    std::optional<std::pair<P,P>>{{a, b}});
+}
+
+} // namespace electra::wire
+
+#endif
@@ -0,0 +1,163 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : tiles
+// @created     : Saturday Oct 24, 2026 10:12:41 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#pragma once
+
+#include <array>
+#include <tuple>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include <electra/wire/encode.hpp>
+#include <electra/wire/decode.hpp>
+
+namespace electra::wire::tile
+{
+
+//
+// A wire template, its cells and encoded form are both
+// computed at compile time, so inserting it only takes a
+// translation of the precomputed data
+//
+template<typename P, std::size_t N, std::size_t M>
+struct Tile
+{
+  std::array<P,N> cells;
+  std::array<P,M> encoded;
+};
+
+//
+// Builds the tile of a std::array of cells with static storage
+//
+template<auto const& cells>
+constexpr auto make() noexcept
+{
+  using P = typename std::decay_t<decltype(cells)>::value_type;
+  return Tile<P, std::tuple_size_v<std::decay_t<decltype(cells)>>,
+    std::tuple_size_v<std::decay_t<decltype(encoded<cells>)>>>
+      { cells, encoded<cells> };
+}
+
+//
+// Translates an encoded list in place, the points are the
+// even elements, the directions in between are kept
+//
+template<typename InIt, typename P>
+constexpr void translate( InIt it_beg, InIt it_end, P const& offset ) noexcept
+{
+  bool point {true};
+  for( auto it{it_beg}; it != it_end; ++it, point = ! point )
+  {
+    if( ! point ) continue;
+    (*it).first += offset.first;
+    (*it).second += offset.second;
+  }
+}
+
+//
+// Standard patterns of a side x side tile, the signal enters
+// by the center of the first side named and leaves by the center
+// of the second one; y grows southwards
+//
+inline constexpr std::size_t side {5};
+
+namespace cells
+{
+
+template<typename T>
+inline constexpr std::array<std::pair<T,T>,5> west_east
+  {{ {0,2},{1,2},{2,2},{3,2},{4,2} }};
+template<typename T>
+inline constexpr std::array<std::pair<T,T>,5> north_south
+  {{ {2,0},{2,1},{2,2},{2,3},{2,4} }};
+template<typename T>
+inline constexpr std::array<std::pair<T,T>,5> west_north
+  {{ {0,2},{1,2},{2,2},{2,1},{2,0} }};
+template<typename T>
+inline constexpr std::array<std::pair<T,T>,5> west_south
+  {{ {0,2},{1,2},{2,2},{2,3},{2,4} }};
+template<typename T>
+inline constexpr std::array<std::pair<T,T>,5> north_east
+  {{ {2,0},{2,1},{2,2},{3,2},{4,2} }};
+template<typename T>
+inline constexpr std::array<std::pair<T,T>,5> south_east
+  {{ {2,4},{2,3},{2,2},{3,2},{4,2} }};
+template<typename T>
+inline constexpr std::array<std::pair<T,T>,9> west_east_bend
+  {{ {0,2},{1,2},{1,1},{2,1},{3,1},{3,2},{3,3},{4,3},{4,2} }};
+
+// Halves of a tile, from a side to the center or back
+template<typename T>
+inline constexpr std::array<std::pair<T,T>,3> west_center
+  {{ {0,2},{1,2},{2,2} }};
+template<typename T>
+inline constexpr std::array<std::pair<T,T>,3> north_center
+  {{ {2,0},{2,1},{2,2} }};
+template<typename T>
+inline constexpr std::array<std::pair<T,T>,3> south_center
+  {{ {2,4},{2,3},{2,2} }};
+template<typename T>
+inline constexpr std::array<std::pair<T,T>,3> center_east
+  {{ {2,2},{3,2},{4,2} }};
+template<typename T>
+inline constexpr std::array<std::pair<T,T>,3> center_south
+  {{ {2,2},{2,3},{2,4} }};
+
+} // namespace cells
+
+template<typename T>
+inline constexpr auto west_east { make<cells::west_east<T>>() };
+template<typename T>
+inline constexpr auto north_south { make<cells::north_south<T>>() };
+template<typename T>
+inline constexpr auto west_north { make<cells::west_north<T>>() };
+template<typename T>
+inline constexpr auto west_south { make<cells::west_south<T>>() };
+template<typename T>
+inline constexpr auto north_east { make<cells::north_east<T>>() };
+template<typename T>
+inline constexpr auto south_east { make<cells::south_east<T>>() };
+template<typename T>
+inline constexpr auto west_east_bend { make<cells::west_east_bend<T>>() };
+
+//
+// Gate footprints, one tile per wire of the gate, all of them
+// meeting at the center cell; inputs enter by the west, north
+// and south sides and outputs leave by the east and south ones
+//
+template<typename... Tiles>
+using Footprint = std::tuple<Tiles...>;
+
+// One input copied to two outputs
+template<typename T>
+inline constexpr std::tuple fan_out { make<cells::west_center<T>>(),
+  make<cells::center_east<T>>(), make<cells::center_south<T>>() };
+
+//
+// Two inputs and an output, the footprint of both AND and OR
+// gates, which only differ by the polarization of their fixed
+// input; that one is not a wire
+//
+template<typename T>
+inline constexpr std::tuple conjunction { make<cells::north_center<T>>(),
+  make<cells::south_center<T>>(), make<cells::center_east<T>>() };
+
+// Three inputs and an output
+template<typename T>
+inline constexpr std::tuple majority { make<cells::west_center<T>>(),
+  make<cells::north_center<T>>(), make<cells::south_center<T>>(),
+  make<cells::center_east<T>>() };
+
+// Two signals crossing at the center
+template<typename T>
+inline constexpr std::tuple crossing { make<cells::west_east<T>>(),
+  make<cells::north_south<T>>() };
+
+} // namespace electra::wire::tile
@@ -10,38 +10,88 @@
 
 #pragma once
 
+#include <array>
+#include <tuple>
 #include <vector>
 #include <memory>
+#include <memory_resource>
 #include <algorithm>
 #include <nlohmann/json.hpp>
 #include <fstream>
+#include <iostream>
 #include <optional>
+#include <iterator>
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
+#if __has_include(<version>)
+#include <version>
+#endif
+#ifdef __cpp_lib_span
+#include <span>
+#endif
 
 #include <electra/area.hpp>
+#include <electra/arena.hpp>
+#include <electra/density.hpp>
+#include <electra/executor.hpp>
+#include <electra/occupancy.hpp>
+#include <electra/point.hpp>
+#include <electra/fingerprint.hpp>
+#include <electra/instrument.hpp>
+#include <electra/memory.hpp>
+#include <electra/routes.hpp>
+#include <electra/trace.hpp>
+#include <electra/timeline.hpp>
+#include <electra/wire/encode.hpp>
+#include <electra/wire/decode.hpp>
+#include <electra/wire/edit.hpp>
+#include <electra/wire/slots.hpp>
 #include <electra/wire/const_iterator.hpp>
+#include <electra/wire/stream.hpp>
+#include <electra/wire/tiles.hpp>
 
 namespace electra::wire
 {
 // Data types
 template<typename T>
-using _Wires = std::vector<std::vector<std::pair<T,T>>>;
+using _Wires = std::pmr::vector<std::pmr::vector<std::pair<T,T>>>;
+
+using Handle = slots::Handle;
 
 // Dynamic memory storage
 template<typename T>
-using Storage = std::unique_ptr<_Wires<T>>;
+using Storage = arena::Pointer<_Wires<T>>;
+template<typename T>
+using Area = std::shared_ptr<area::Area<T>>;
+template<typename T>
+using Density = std::unique_ptr<density::Density<T>>;
 template<typename T>
-using Area = std::unique_ptr<area::Area<T>>;
+using Occupancy = std::shared_ptr<occupancy::Occupancy<T>>;
+using Fingerprint = std::unique_ptr<fingerprint::Fingerprint>;
+template<typename T>
+using Routes = std::shared_ptr<routes::Cache<T>>;
+using Trace = std::shared_ptr<trace::Trace>;
 
 template<typename T>
 class Wires
 {
   private:
   // Private Members
+    instrument::Counters counters;
     Storage<T> wires;
+    slots::Slots slots;
     Area<T> area;
+    Density<T> density;
+    Occupancy<T> occupancy;
+    Fingerprint fingerprint;
+    Routes<T> routes;
+    Trace trace;
+    std::pmr::vector<std::pair<T,T>> scratch;
   public:
   // Constructors
-    Wires();
+    explicit Wires(std::pmr::memory_resource* resource
+      = std::pmr::get_default_resource());
   // Iterators
     const_iterator::const_iterator<_Wires<T>,
       typename _Wires<T>::const_iterator> cbegin() const noexcept;
@@ -50,19 +100,71 @@ class Wires
   // Public Methods
     // Capacity
     auto size() const noexcept;
+    memory::Usage memory_usage() const noexcept;
     // Modifiers
     template<typename U = std::vector<std::pair<T,T>>>
-    void insert(U&& u) noexcept;
-    template<typename U = std::pair<T,T>>
+    Handle insert(U&& u) noexcept;
+#ifdef __cpp_lib_span
+    Handle insert(std::span<std::pair<T,T> const> cells) noexcept;
+#endif
+    template<std::size_t N, std::size_t M>
+    Handle insert(tile::Tile<std::pair<T,T>,N,M> const& tile,
+      std::pair<T,T> const& offset) noexcept;
+    template<typename... Tiles>
+    std::array<Handle,sizeof...(Tiles)> insert(tile::Footprint<Tiles...> const& footprint,
+      std::pair<T,T> const& offset) noexcept;
+    template<typename InIt>
+    std::vector<Handle> insert(InIt it_beg, InIt it_end,
+      executor::Executor* executor = executor::get_default()) noexcept;
+    bool erase(Handle const& handle) noexcept;
+    template<typename U = std::pair<T,T>,
+      typename = std::enable_if_t<std::is_convertible_v<U, std::pair<T,T>>>>
     void erase(U&& a, U&& b) noexcept;
+    template<typename InIt,
+      typename = typename std::iterator_traits<InIt>::iterator_category>
+    void erase(InIt it_beg, InIt it_end) noexcept;
+    template<typename U = std::pair<T,T>>
+    bool split(U&& a, U&& b, U&& at) noexcept;
+    template<typename U = std::pair<T,T>>
+    bool join(U&& at) noexcept;
+    template<typename U = std::pair<T,T>>
+    bool truncate(U&& a, U&& b, U&& at) noexcept;
+    template<typename U = std::pair<T,T>,
+      typename V = std::vector<std::pair<T,T>>>
+    bool replace(U&& a, U&& b, U&& from, U&& to, V&& path) noexcept;
+    void shrink_to_fit() noexcept;
     // Lookup
     template<typename U = std::pair<T,T>>
     std::optional<const_iterator::const_iterator<_Wires<T>,
       typename _Wires<T>::const_iterator>> find(U&& a, U&& b) noexcept;
+    std::optional<const_iterator::const_iterator<_Wires<T>,
+      typename _Wires<T>::const_iterator>> find(Handle const& handle) const noexcept;
     auto get_area() const noexcept;
+    auto get_bounds() const noexcept;
+    density::Density<T> const* get_density() const noexcept;
+    occupancy::Occupancy<T> const* get_occupancy() const noexcept;
+    fingerprint::Fingerprint get_fingerprint() const noexcept;
+    instrument::Stats get_stats() const noexcept;
+    instrument::Stats get_area_stats() const noexcept;
+#ifdef ELECTRA_COROUTINES
+    generator::Generator<std::pair<T,T>> cells() const noexcept;
+    generator::Generator<std::pair<T,T>> cells(std::pair<T,T> const& a,
+      std::pair<T,T> const& b) const noexcept;
+#endif
     // Operations
+    template<typename U = T, typename = std::enable_if_t<(sizeof(U) <= 4)>>
+    void enable_density(executor::Executor* executor = executor::get_default()) noexcept;
+    template<typename U = T, typename = std::enable_if_t<(sizeof(U) <= 4)>>
+    void enable_occupancy(executor::Executor* executor = executor::get_default()) noexcept;
+    void attach_routes(Routes<T> routes) noexcept;
+    void attach_area(Area<T> area) noexcept;
+    void attach_occupancy(Occupancy<T> occupancy) noexcept;
+    void attach_trace(Trace trace) noexcept;
+    template<typename Key = point::Hilbert>
+    void sort(Key key = {}) noexcept;
     template<typename U>
-    void write(U&& filename) const noexcept;
+    void write(U&& filename,
+      executor::Executor* executor = executor::get_default()) const noexcept;
     template<typename U>
     void read(U&& filename) noexcept;
   private:
@@ -70,8 +172,17 @@ class Wires
     // Lookup
     template<typename U>
     auto find_if(U&& a, U&& b) noexcept;
+    // Modifiers
+    void erase_at(std::size_t index) noexcept;
+    template<typename U = std::vector<std::pair<T,T>>>
+    void occupy(U&& u) noexcept;
+    template<typename U = std::vector<std::pair<T,T>>>
+    void vacate(U&& u) noexcept;
+    void occupy_batch(std::pmr::vector<std::pair<T,T>>& cells) noexcept;
+    void vacate_batch(std::pmr::vector<std::pair<T,T>>& cells) noexcept;
     // Operations
-    auto json() const noexcept;
+    void decode_all(executor::Executor* executor) noexcept;
+    auto json(executor::Executor* executor = executor::get_default()) const noexcept;
   public:
   // Operators
     template<typename U>
@@ -85,11 +196,16 @@ class Wires
 // Constructors
 //
 template<typename T>
-Wires<T>::Wires()
-  : wires(std::make_unique<
-    typename Storage<T>::element_type>())
-  , area(std::make_unique<
-    typename Area<T>::element_type>())
+Wires<T>::Wires(std::pmr::memory_resource* resource)
+  : counters(resource)
+  , wires(arena::make<
+    typename Storage<T>::element_type>(this->counters.resource()))
+  , slots(this->counters.resource())
+  , area(arena::share<
+    typename Area<T>::element_type>(resource))
+  , fingerprint(std::make_unique<
+    typename Fingerprint::element_type>())
+  , scratch(this->counters.resource())
 {
 }
 
@@ -100,14 +216,14 @@ template<typename T>
 const_iterator::const_iterator<_Wires<T>,
   typename _Wires<T>::const_iterator> Wires<T>::cbegin() const noexcept
 {
-  return const_iterator::const_iterator(*this->wires, this->wires->cbegin());
+  return const_iterator::const_iterator(*this->wires, this->wires->cbegin(), this->counters);
 }
 
 template<typename T>
 const_iterator::const_iterator<_Wires<T>,
   typename _Wires<T>::const_iterator> Wires<T>::cend() const noexcept
 {
-  return const_iterator::const_iterator(*this->wires, this->wires->cend());
+  return const_iterator::const_iterator(*this->wires, this->wires->cend(), this->counters);
 }
 
 //
@@ -120,21 +236,336 @@ auto Wires<T>::size() const noexcept
 }
 
 template<typename T>
-template<typename U>
+memory::Usage Wires<T>::memory_usage() const noexcept
+{
+  auto resource { this->counters.resource() };
+
+  //
+  // The headers of the wires are the index, each encoded wire
+  // is an allocation of its own
+  //
+  auto usage { memory::object<_Wires<T>>(resource) };
+  auto headers { memory::vector(*this->wires) };
+  headers.index += headers.payload;
+  headers.payload = 0;
+  usage += headers;
+  for( auto const& wire : *this->wires ) usage += memory::vector(wire);
+  usage += this->slots.memory_usage();
+
+  // The scratch buffer only holds cells during an operation
+  auto scratch { memory::vector(this->scratch) };
+  scratch.slack += scratch.payload;
+  scratch.payload = 0;
+  usage += scratch;
+
+  // Attached state is counted as in Placements::memory_usage
+  usage += memory::shared<area::Area<T>>(resource);
+  usage += this->area->memory_usage();
+  usage += memory::object<fingerprint::Fingerprint>();
+
+  if( this->density )
+  {
+    usage += memory::object<density::Density<T>>();
+    usage += this->density->memory_usage();
+  }
+  if( this->occupancy )
+  {
+    usage += memory::shared<occupancy::Occupancy<T>>();
+    usage += this->occupancy->memory_usage();
+  }
+
+  return usage;
+}
+
+template<typename T>
+template<typename U, typename>
 void Wires<T>::erase(U&& a, U&& b) noexcept
 {
+  if( this->trace ) this->trace->op(trace::Op::WIRE_ERASE).cell(a).cell(b);
+  auto timer { this->counters.time() };
+
   auto it {this->find_if(std::forward<U>(a),std::forward<U>(b))};
 
   if( it == this->wires->cend() ) return;
 
+  this->erase_at(static_cast<std::size_t>(std::distance(this->wires->cbegin(), it)));
+}
+
+template<typename T>
+bool Wires<T>::erase(Handle const& handle) noexcept
+{
+  auto timer { this->counters.time() };
+
+  auto index { this->slots.find(handle) };
+  if( ! index ) return false;
+
+  // Endpoints may be shared, the handle names the wire to replay
+  if( this->trace ) this->trace->op(trace::Op::WIRE_ERASE_HANDLE).handle(handle.index, handle.generation);
+
+  this->erase_at(*index);
+  return true;
+}
+
+template<typename T>
+template<typename InIt, typename>
+void Wires<T>::erase(InIt it_beg, InIt it_end) noexcept
+{
+  timeline::Scope scope {"wires.erase"};
+  auto timer { this->counters.time() };
+
+  //
+  // The endpoints are sorted along with the number of times
+  // each pair is given, and the wires scanned once; each wire
+  // whose endpoints are still wanted is erased, so the first
+  // matching wires go, as with erase(a,b)
+  //
+  using Endpoints = std::pair<std::pair<T,T>,std::pair<T,T>>;
+  std::vector<std::pair<Endpoints,std::size_t>> wanted;
+
+  for( auto it{it_beg}; it != it_end; ++it )
+  {
+    wanted.emplace_back(Endpoints(it->first, it->second), 1);
+  }
+
+  //
+  // Recorded as a single operation, a replay must also keep
+  // the order of the other wires, which erase(a,b) does not
+  //
+  if( this->trace )
+  {
+    this->scratch.clear();
+    for( auto const& entry : wanted )
+    {
+      this->scratch.push_back(entry.first.first);
+      this->scratch.push_back(entry.first.second);
+    }
+    this->trace->op(trace::Op::WIRE_ERASE_BATCH).cells(this->scratch.cbegin(), this->scratch.cend());
+  }
+
+  std::sort(wanted.begin(), wanted.end());
+  auto runs { wanted.begin() };
+  for( auto it{wanted.begin()}; it != wanted.end(); ++it )
+  {
+    if( it != wanted.begin() && std::prev(runs)->first == it->first ) ++std::prev(runs)->second;
+    else *runs++ = *it;
+  }
+  wanted.erase(runs, wanted.end());
+
+  this->counters.count(&instrument::Stats::probes, this->wires->size());
+  this->scratch.clear();
+
+  std::size_t out {0};
+  for( std::size_t k{0}; k < this->wires->size(); ++k )
+  {
+    auto it { this->wires->begin() + static_cast<std::ptrdiff_t>(k) };
+    auto search { it->empty() ? wanted.end() : std::lower_bound(wanted.begin(), wanted.end(),
+      Endpoints(it->front(), it->back()),
+      [](auto const& entry, auto const& key) { return entry.first < key; }) };
+
+    if( search != wanted.end() && search->first == Endpoints(it->front(), it->back())
+      && search->second > 0 )
+    {
+      --search->second;
+      auto size { this->scratch.size() };
+      decode_into(it->cbegin(), it->cend(), std::back_inserter(this->scratch));
+      this->counters.count(&instrument::Stats::decodes);
+      this->counters.count(&instrument::Stats::cells, this->scratch.size() - size);
+      *this->fingerprint -= fingerprint::wire(*it);
+      this->slots.release(k);
+      continue;
+    }
+
+    if( out != k )
+    {
+      (*this->wires)[out] = std::move(*it);
+      this->slots.move(k, out);
+    }
+    ++out;
+  }
+  this->wires->resize(out);
+  this->slots.resize(out);
+
+  this->vacate_batch(this->scratch);
+}
+
+template<typename T>
+template<typename U>
+bool Wires<T>::split(U&& a, U&& b, U&& at) noexcept
+{
+  if( this->trace ) this->trace->op(trace::Op::SPLIT).cell(a).cell(b).cell(at);
+  auto timer { this->counters.time() };
+
+  if( at == a || at == b ) return false;
+
+  auto it {this->find_if(a,b)};
+  if( it == this->wires->cend() ) return false;
+
+  auto parts { edit::split(*it, at) };
+  if( ! parts ) return false;
+
+  //
+  // Both halves hold the splitting cell, it is
+  // the only cell whose count changes
+  //
+  this->occupy({at});
+  *this->fingerprint -= fingerprint::wire(*it);
+  *this->fingerprint += fingerprint::wire(parts->first) + fingerprint::wire(parts->second);
+
+  // The first half keeps the handle of the wire
+  auto index { std::distance(this->wires->cbegin(), it) };
+  (*this->wires)[index] = std::move(parts->first);
+  this->wires->emplace_back(std::move(parts->second));
+  this->slots.push();
+
+  return true;
+}
+
+template<typename T>
+template<typename U>
+bool Wires<T>::join(U&& at) noexcept
+{
+  if( this->trace ) this->trace->op(trace::Op::JOIN).cell(at);
+  auto timer { this->counters.time() };
+
+  //
+  // Look for a wire ending and another one starting in the
+  // given cell, reversing one of them when both share the
+  // same orientation
+  //
+  auto ends = [&](auto const& wire) { return wire.back() == at; };
+  auto starts = [&](auto const& wire) { return wire.front() == at; };
+  auto other = [&](auto first, auto pred)
+  {
+    return std::find_if(this->wires->begin(), this->wires->end(),
+      [&](auto const& wire){ return pred(wire) && &wire != &*first; });
+  };
+
+  auto first {std::find_if(this->wires->begin(), this->wires->end(), ends)};
+  auto second {this->wires->end()};
+  bool reverse_first {false}, reverse_second {false};
+
+  if( first != this->wires->end() )
+  {
+    second = other(first, starts);
+    if( second == this->wires->end() )
+    {
+      second = other(first, ends);
+      reverse_second = true;
+    }
+  }
+  else
+  {
+    first = std::find_if(this->wires->begin(), this->wires->end(), starts);
+    if( first == this->wires->end() ) return false;
+    second = other(first, starts);
+    reverse_first = true;
+  }
+
+  // Each search visits every wire at worst
+  this->counters.count(&instrument::Stats::probes, 2 * this->wires->size());
+  if( second == this->wires->end() ) return false;
+
+  //
+  // Wires are only changed once they are known to join
+  //
+  auto joined { edit::join(reverse_first ? edit::reverse(*first) : *first,
+    reverse_second ? edit::reverse(*second) : *second) };
+  if( ! joined ) return false;
+
+  this->vacate({at});
+  *this->fingerprint += fingerprint::wire(*joined);
+  *this->fingerprint -= fingerprint::wire(*first) + fingerprint::wire(*second);
+
+  //
+  // The joined wire keeps the handle of the first one, the
+  // last wire takes the place of the second
+  //
+  auto index { static_cast<std::size_t>(std::distance(this->wires->begin(), second)) };
+  *first = std::move(*joined);
+  (*this->wires)[index].swap(this->wires->back());
+  this->wires->pop_back();
+  this->slots.erase(index);
+
+  return true;
+}
+
+template<typename T>
+template<typename U>
+bool Wires<T>::truncate(U&& a, U&& b, U&& at) noexcept
+{
+  if( this->trace ) this->trace->op(trace::Op::TRUNCATE).cell(a).cell(b).cell(at);
+  auto timer { this->counters.time() };
+
+  auto it {this->find_if(a,b)};
+  if( it == this->wires->cend() ) return false;
+
+  auto parts { edit::split(*it, at) };
+  if( ! parts ) return false;
+
+  //
+  // Unset the cells past the truncation point, which
+  // itself is kept by the remaining wire
+  //
+  this->scratch.clear();
+  decode_into(parts->second.cbegin(), parts->second.cend(),
+    std::back_inserter(this->scratch));
+  this->counters.count(&instrument::Stats::decodes);
+  this->counters.count(&instrument::Stats::cells, this->scratch.size());
+  if( ! this->scratch.empty() ) this->scratch.erase(this->scratch.begin());
+  this->vacate(this->scratch);
+  *this->fingerprint += fingerprint::wire(parts->first) - fingerprint::wire(*it);
+
+  auto index { std::distance(this->wires->cbegin(), it) };
+  (*this->wires)[index] = std::move(parts->first);
+
+  return true;
+}
+
+template<typename T>
+template<typename U, typename V>
+bool Wires<T>::replace(U&& a, U&& b, U&& from, U&& to, V&& path) noexcept
+{
+  if( this->trace )
+  {
+    this->trace->op(trace::Op::REPLACE).cell(a).cell(b).cell(from).cell(to)
+      .cells(std::cbegin(path), std::cend(path));
+  }
+  auto timer { this->counters.time() };
+
+  if( std::empty(path) ) return false;
+  if( *std::cbegin(path) != from || *std::crbegin(path) != to ) return false;
+
+  auto it {this->find_if(a,b)};
+  if( it == this->wires->cend() ) return false;
+
+  auto encoded { wire::encode(std::cbegin(path), std::cend(path),
+    this->wires->get_allocator()) };
+  auto replaced { edit::replace(*it, from, to, encoded) };
+  if( ! replaced ) return false;
+
   //
-  // Decode the wire to unset each region from
-  // the area class
+  // Only the cells strictly between the common prefix and
+  // suffix of the old and new sub-wires change their count
   //
-  auto decoded_wire { decode(it->cbegin(), it->cend()) };
-  area->erase( decoded_wire );
+  auto sliced { edit::slice(*it, from, to) };
+  auto old_cells { wire::decode(sliced->cbegin(), sliced->cend()) };
+  this->counters.count(&instrument::Stats::decodes);
+  this->counters.count(&instrument::Stats::cells, old_cells.size());
+
+  auto [old_beg, new_beg] { std::mismatch(old_cells.cbegin(), old_cells.cend(),
+    std::cbegin(path), std::cend(path)) };
+  auto [old_end, new_end] { std::mismatch(old_cells.crbegin(),
+    std::make_reverse_iterator(old_beg), std::crbegin(path),
+    std::make_reverse_iterator(new_beg)) };
+
+  this->vacate(std::vector<std::pair<T,T>>(old_beg, old_end.base()));
+  this->occupy(std::vector<std::pair<T,T>>(new_beg, new_end.base()));
+  *this->fingerprint += fingerprint::wire(*replaced) - fingerprint::wire(*it);
+
+  auto index { std::distance(this->wires->cbegin(), it) };
+  (*this->wires)[index] = std::move(*replaced);
 
-  this->wires->erase( it );
+  return true;
 }
 
 template<typename T>
@@ -142,6 +573,9 @@ template<typename U>
 std::optional<const_iterator::const_iterator<_Wires<T>,
   typename _Wires<T>::const_iterator>> Wires<T>::find(U&& a, U&& b) noexcept
 {
+  if( this->trace ) this->trace->op(trace::Op::WIRE_FIND).cell(a).cell(b);
+  auto timer { this->counters.time() };
+
   auto search { this->find_if(std::forward<U>(a),std::forward<U>(b)) };
   if( search == this->wires->cend() )
   {
@@ -149,35 +583,337 @@ std::optional<const_iterator::const_iterator<_Wires<T>,
   }
   else
   {
-    return const_iterator::const_iterator(*this->wires, search);
+    return const_iterator::const_iterator(*this->wires, search, this->counters);
   }
 }
 
+template<typename T>
+std::optional<const_iterator::const_iterator<_Wires<T>,
+  typename _Wires<T>::const_iterator>> Wires<T>::find(Handle const& handle) const noexcept
+{
+  auto index { this->slots.find(handle) };
+  if( ! index ) return std::nullopt;
+
+  return const_iterator::const_iterator(*this->wires,
+    this->wires->cbegin() + static_cast<std::ptrdiff_t>(*index), this->counters);
+}
+
 template<typename T>
 auto Wires<T>::get_area() const noexcept
 {
   return this->area->get_area();
 }
 
+template<typename T>
+auto Wires<T>::get_bounds() const noexcept
+{
+  return this->area->get_bounds();
+}
+
+template<typename T>
+density::Density<T> const* Wires<T>::get_density() const noexcept
+{
+  return this->density.get();
+}
+
+template<typename T>
+occupancy::Occupancy<T> const* Wires<T>::get_occupancy() const noexcept
+{
+  return this->occupancy.get();
+}
+
+template<typename T>
+fingerprint::Fingerprint Wires<T>::get_fingerprint() const noexcept
+{
+  return *this->fingerprint;
+}
+
+template<typename T>
+instrument::Stats Wires<T>::get_stats() const noexcept
+{
+  return this->counters.get();
+}
+
+template<typename T>
+instrument::Stats Wires<T>::get_area_stats() const noexcept
+{
+  return this->area->get_stats();
+}
+
+#ifdef ELECTRA_COROUTINES
+template<typename T>
+generator::Generator<std::pair<T,T>> Wires<T>::cells() const noexcept
+{
+  //
+  // Streams the cells of every wire without decoding them,
+  // the wires must not change while it is consumed
+  //
+  return wire::stream(this->wires->cbegin(), this->wires->cend());
+}
+
+template<typename T>
+generator::Generator<std::pair<T,T>> Wires<T>::cells(std::pair<T,T> const& a,
+  std::pair<T,T> const& b) const noexcept
+{
+  return wire::stream(this->wires->cbegin(), this->wires->cend(),
+    std::optional<std::pair<std::pair<T,T>,std::pair<T,T>>>{{a, b}});
+}
+#endif
+
 template<typename T>
 template<typename U>
-void Wires<T>::insert(U&& u) noexcept
+Handle Wires<T>::insert(U&& u) noexcept
+{
+  //
+  // The encoded wire is sized beforehand, it takes a
+  // single allocation
+  //
+  if( this->trace ) this->trace->op(trace::Op::WIRE_INSERT).cells(std::cbegin(u), std::cend(u));
+  auto timer { this->counters.time() };
+
+  this->occupy(u);
+  auto& encoded { this->wires->emplace_back() };
+  encoded.reserve(encoded_size(std::cbegin(u), std::cend(u)));
+  encode_into(std::cbegin(u), std::cend(u), std::back_inserter(encoded));
+  *this->fingerprint += fingerprint::wire(encoded);
+
+  return this->slots.push();
+}
+
+template<typename T>
+template<typename InIt>
+std::vector<Handle> Wires<T>::insert(InIt it_beg, InIt it_end,
+  executor::Executor* executor) noexcept
+{
+  timeline::Scope scope {"wires.insert"};
+  auto timer { this->counters.time() };
+
+  std::vector<InIt> items;
+  this->scratch.clear();
+  for( auto it{it_beg}; it != it_end; ++it )
+  {
+    if( this->trace ) this->trace->op(trace::Op::WIRE_INSERT).cells(std::cbegin(*it), std::cend(*it));
+    items.push_back(it);
+    this->scratch.insert(this->scratch.end(), std::cbegin(*it), std::cend(*it));
+  }
+
+  //
+  // Wires are sized and encoded on the executor, the buffers
+  // are allocated in between on this thread, as the resource
+  // of the wires may not be shared by threads
+  //
+  std::vector<std::size_t> sizes(items.size());
+  executor::for_each(executor, items.size(), 0, [&](std::size_t beg, std::size_t end)
+  {
+    for( auto k{beg}; k < end; ++k )
+    {
+      sizes[k] = encoded_size(std::cbegin(*items[k]), std::cend(*items[k]));
+    }
+  });
+
+  auto first { this->wires->size() };
+  this->wires->resize(first + items.size());
+  for( std::size_t k{0}; k < items.size(); ++k ) (*this->wires)[first + k].resize(sizes[k]);
+
+  std::vector<fingerprint::Fingerprint> prints(items.size());
+  executor::for_each(executor, items.size(), 0, [&](std::size_t beg, std::size_t end)
+  {
+    for( auto k{beg}; k < end; ++k )
+    {
+      auto& encoded { (*this->wires)[first + k] };
+      encode_into(std::cbegin(*items[k]), std::cend(*items[k]), encoded.begin());
+      prints[k] = fingerprint::wire(encoded);
+    }
+  });
+
+  for( auto const& print : prints ) *this->fingerprint += print;
+
+  this->occupy_batch(this->scratch);
+
+  std::vector<Handle> handles;
+  handles.reserve(items.size());
+  for( std::size_t k{0}; k < items.size(); ++k ) handles.push_back(this->slots.push());
+  return handles;
+}
+
+#ifdef __cpp_lib_span
+template<typename T>
+Handle Wires<T>::insert(std::span<std::pair<T,T> const> cells) noexcept
+{
+  return this->template insert<std::span<std::pair<T,T> const>&>(cells);
+}
+#endif
+
+template<typename T>
+template<std::size_t N, std::size_t M>
+Handle Wires<T>::insert(tile::Tile<std::pair<T,T>,N,M> const& tile,
+  std::pair<T,T> const& offset) noexcept
+{
+  //
+  // The tile is encoded and decoded at compile time, both
+  // forms are only translated to the offset
+  //
+  auto timer { this->counters.time() };
+  this->scratch.assign(tile.cells.cbegin(), tile.cells.cend());
+  for( auto& cell : this->scratch )
+  {
+    cell.first += offset.first;
+    cell.second += offset.second;
+  }
+  this->occupy(this->scratch);
+  if( this->trace )
+  {
+    this->trace->op(trace::Op::WIRE_INSERT).cells(this->scratch.cbegin(), this->scratch.cend());
+  }
+
+  auto& encoded { this->wires->emplace_back(tile.encoded.cbegin(), tile.encoded.cend()) };
+  tile::translate(encoded.begin(), encoded.end(), offset);
+  *this->fingerprint += fingerprint::wire(encoded);
+
+  return this->slots.push();
+}
+
+template<typename T>
+template<typename... Tiles>
+std::array<Handle,sizeof...(Tiles)> Wires<T>::insert(tile::Footprint<Tiles...> const& footprint,
+  std::pair<T,T> const& offset) noexcept
+{
+  // Each wire of the footprint is a tile of its own
+  return std::apply([&](auto const&... tile)
+  {
+    return std::array<Handle,sizeof...(Tiles)>{ this->insert(tile, offset)... };
+  }, footprint);
+}
+
+template<typename T>
+void Wires<T>::shrink_to_fit() noexcept
+{
+  if( this->density ) this->density->shrink_to_fit();
+  if( this->occupancy ) this->occupancy->shrink_to_fit();
+
+  //
+  // Buffers moved on an arena are never given back, shrinking
+  // them would only grow the arena
+  //
+  if( dynamic_cast<arena::Arena*>(this->counters.resource()) ) return;
+
+  for( auto& wire : *this->wires ) wire.shrink_to_fit();
+  this->wires->shrink_to_fit();
+  this->slots.shrink_to_fit();
+  this->scratch.clear();
+  this->scratch.shrink_to_fit();
+}
+
+template<typename T>
+template<typename U, typename>
+void Wires<T>::enable_density(executor::Executor* executor) noexcept
+{
+  timeline::Scope scope {"wires.enable_density"};
+  //
+  // The density map is only kept when requested,
+  // it is filled with the cells of the current wires
+  //
+  this->density = std::make_unique<density::Density<T>>();
+
+  this->decode_all(executor);
+  this->density->insert(this->scratch);
+}
+
+template<typename T>
+template<typename U, typename>
+void Wires<T>::enable_occupancy(executor::Executor* executor) noexcept
+{
+  timeline::Scope scope {"wires.enable_occupancy"};
+  //
+  // The occupancy bitmap is only kept when requested,
+  // it is filled with the cells of the current wires in
+  // morton order, so each chunk is filled in a single run
+  //
+  this->occupancy = std::make_shared<occupancy::Occupancy<T>>();
+
+  this->decode_all(executor);
+  point::sort(executor, this->scratch.begin(), this->scratch.end(), point::Morton{});
+  this->occupancy->insert(this->scratch);
+}
+
+template<typename T>
+void Wires<T>::attach_routes(Routes<T> routes) noexcept
+{
+  //
+  // The route cache may be shared with other containers,
+  // edits invalidate the routes depending on their cells
+  //
+  this->routes = std::move(routes);
+}
+
+template<typename T>
+void Wires<T>::attach_area(Area<T> area) noexcept
+{
+  //
+  // The area may be shared with other containers, which
+  // then keep a single set of histograms; it is expected
+  // to already hold the cells of these wires
+  //
+  this->area = std::move(area);
+}
+
+template<typename T>
+void Wires<T>::attach_occupancy(Occupancy<T> occupancy) noexcept
 {
-  area->insert(u);
-  this->wires->emplace_back(wire::encode(u.cbegin(), u.cend()));
+  // Same as attach_area, a null occupancy detaches it
+  this->occupancy = std::move(occupancy);
 }
 
+template<typename T>
+void Wires<T>::attach_trace(Trace trace) noexcept
+{
+  //
+  // Every lookup and edit is logged to the trace, which may
+  // be shared with placements to keep the order of both
+  //
+  this->trace = std::move(trace);
+}
 
+template<typename T>
+template<typename Key>
+void Wires<T>::sort(Key key) noexcept
+{
+  timeline::Scope scope {"wires.sort"};
+  //
+  // Orders the wires along a curve by their first cell,
+  // copying them to fresh storage in that order so that
+  // neighbouring wires are also close in memory
+  //
+  std::vector<std::pair<std::uint64_t,std::size_t>> order;
+  order.reserve(this->wires->size());
+  for( std::size_t i{0}; i < this->wires->size(); ++i )
+  {
+    order.emplace_back(key((*this->wires)[i].front()), i);
+  }
+  std::sort(order.begin(), order.end());
+
+  _Wires<T> sorted(this->wires->get_allocator());
+  sorted.reserve(order.size());
+  for( auto const& entry : order )
+  {
+    auto const& wire { (*this->wires)[entry.second] };
+    sorted.emplace_back(wire.cbegin(), wire.cend());
+  }
+
+  *this->wires = std::move(sorted);
+  this->slots.permute([&](std::size_t k) { return order[k].second; });
+}
 
 template<typename T>
 template<typename U>
-void Wires<T>::write(U&& filename) const noexcept
+void Wires<T>::write(U&& filename, executor::Executor* executor) const noexcept
 {
+  timeline::Scope scope {"wires.write"};
   std::ofstream file{std::forward<U>(filename)};
 
   if( file.good() )
   {
-    file << this->json();
+    file << this->json(executor);
   }
 }
 
@@ -185,16 +921,47 @@ template<typename T>
 template<typename U>
 void Wires<T>::read(U&& filename) noexcept
 {
+  timeline::Scope scope {"wires.read"};
   using Json = nlohmann::json;
 
   std::ifstream file{std::forward<U>(filename)};
 
   if( file.good() )
   {
-    this->wires = std::make_unique<_Wires<T>>();
     Json j;
     file >> j;
-    *this->wires = j.get<_Wires<T>>();
+
+    //
+    // The area and occupancy may be shared with other
+    // containers, the cells of the previous wires are released
+    // from them and the ones of the loaded wires taken
+    //
+    this->decode_all(executor::get_default());
+    this->vacate_batch(this->scratch);
+
+    //
+    // The document holds the decoded cells, see json
+    //
+    this->wires->clear();
+    for( auto const& cells : j.get<std::vector<std::vector<std::pair<T,T>>>>() )
+    {
+      auto& encoded { this->wires->emplace_back() };
+      encoded.reserve(encoded_size(cells.cbegin(), cells.cend()));
+      encode_into(cells.cbegin(), cells.cend(), std::back_inserter(encoded));
+    }
+
+    this->decode_all(executor::get_default());
+    this->occupy_batch(this->scratch);
+
+    // Handles to the previous wires go stale
+    this->slots.clear();
+    for( std::size_t k{0}; k < this->wires->size(); ++k ) this->slots.push();
+
+    *this->fingerprint = {};
+    for( auto const& wire : *this->wires )
+    {
+      *this->fingerprint += fingerprint::wire(wire);
+    }
   }
 
 }
@@ -206,23 +973,140 @@ template<typename T>
 template<typename U>
 auto Wires<T>::find_if(U&& a, U&& b) noexcept
 {
-  return std::find_if(this->wires->cbegin(), this->wires->cend(),
+  auto search { std::find_if(this->wires->cbegin(), this->wires->cend(),
     [&](auto const& wire)
     {
       return ( a == *(wire.begin()) ) && ( b == *(wire.rbegin()) );
     }
-  );
+  ) };
+
+  this->counters.count(&instrument::Stats::probes,
+    static_cast<std::uint64_t>(std::distance(this->wires->cbegin(), search)) + 1);
+
+  return search;
 }
 
 template<typename T>
-auto Wires<T>::json() const noexcept
+void Wires<T>::erase_at(std::size_t index) noexcept
 {
-  using Json = nlohmann::json;
-  Json j;
-  for(auto it{this->cbegin()}; it != this->cend(); ++it)
+  //
+  // Decode the wire to unset each region from the area
+  // class; the last wire then takes its place, so no other
+  // wire is moved
+  //
+  auto& wire { (*this->wires)[index] };
+  this->scratch.clear();
+  decode_into(wire.cbegin(), wire.cend(), std::back_inserter(this->scratch));
+  this->counters.count(&instrument::Stats::decodes);
+  this->counters.count(&instrument::Stats::cells, this->scratch.size());
+  this->vacate( this->scratch );
+  *this->fingerprint -= fingerprint::wire(wire);
+
+  wire.swap(this->wires->back());
+  this->wires->pop_back();
+  this->slots.erase(index);
+}
+
+template<typename T>
+template<typename U>
+void Wires<T>::occupy(U&& u) noexcept
+{
+  this->area->insert(u);
+  if( this->density ) this->density->insert(u);
+  if( this->occupancy ) this->occupancy->insert(u);
+  if( this->routes ) this->routes->invalidate(u);
+}
+
+template<typename T>
+template<typename U>
+void Wires<T>::vacate(U&& u) noexcept
+{
+  this->area->erase(u);
+  if( this->density ) this->density->erase(u);
+  if( this->occupancy ) this->occupancy->erase(u);
+  if( this->routes ) this->routes->invalidate(u);
+}
+
+template<typename T>
+void Wires<T>::occupy_batch(std::pmr::vector<std::pair<T,T>>& cells) noexcept
+{
+  //
+  // Same as occupy, the area is updated with the count of
+  // each coordinate and the occupancy in morton order
+  //
+  this->area->insert(cells.cbegin(), cells.cend());
+  if( this->density ) this->density->insert(cells);
+  if( this->occupancy )
   {
-    j += *it;
+    point::sort(cells.begin(), cells.end(), point::Morton{});
+    this->occupancy->insert(cells);
   }
+  if( this->routes ) this->routes->invalidate(cells);
+}
+
+template<typename T>
+void Wires<T>::vacate_batch(std::pmr::vector<std::pair<T,T>>& cells) noexcept
+{
+  this->area->erase(cells.cbegin(), cells.cend());
+  if( this->density ) this->density->erase(cells);
+  if( this->occupancy )
+  {
+    point::sort(cells.begin(), cells.end(), point::Morton{});
+    this->occupancy->erase(cells);
+  }
+  if( this->routes ) this->routes->invalidate(cells);
+}
+
+template<typename T>
+void Wires<T>::decode_all(executor::Executor* executor) noexcept
+{
+  //
+  // Fills the scratch buffer with the cells of every wire, in
+  // order; each wire is decoded at its offset on the executor
+  //
+  std::vector<std::size_t> offsets(this->wires->size() + 1, 0);
+  executor::for_each(executor, this->wires->size(), 0, [&](std::size_t beg, std::size_t end)
+  {
+    for( auto k{beg}; k < end; ++k )
+    {
+      auto const& encoded { (*this->wires)[k] };
+      offsets[k + 1] = decoded_size(encoded.cbegin(), encoded.cend());
+    }
+  });
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  this->scratch.resize(offsets.back());
+  executor::for_each(executor, this->wires->size(), 0, [&](std::size_t beg, std::size_t end)
+  {
+    for( auto k{beg}; k < end; ++k )
+    {
+      auto const& encoded { (*this->wires)[k] };
+      decode_into(encoded.cbegin(), encoded.cend(), this->scratch.begin() + offsets[k]);
+    }
+  });
+}
+
+template<typename T>
+auto Wires<T>::json(executor::Executor* executor) const noexcept
+{
+  using Json = nlohmann::json;
+  //
+  // Wires are converted on the executor and then appended in
+  // order, the document does not depend on the executor
+  //
+  std::vector<Json> parts(this->wires->size());
+  executor::for_each(executor, parts.size(), 0, [&](std::size_t beg, std::size_t end)
+  {
+    for( auto k{beg}; k < end; ++k )
+    {
+      auto const& encoded { (*this->wires)[k] };
+      parts[k] = wire::decode(encoded.cbegin(), encoded.cend());
+    }
+  });
+  this->counters.count(&instrument::Stats::decodes, parts.size());
+
+  Json j;
+  for( auto& part : parts ) j.push_back(std::move(part));
   return j;
 }
 
@@ -0,0 +1,102 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : anneal
+// @created     : Wednesday Oct 21, 2026 11:52:19 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <electra/anneal.hpp>
+#include <set>
+
+TEST_CASE("Anneal", "[anneal]")
+{
+  using Placements = electra::placement::Placements<int32_t>;
+  using Cell = std::pair<int32_t,int32_t>;
+
+  Placements placements;
+
+  //
+  // A chain of placements scattered over the region
+  //
+  electra::anneal::Netlist<int32_t> netlist;
+  for( int32_t i{0}; i < 64; ++i )
+  {
+    placements.insert( {{(i*97)%256%16, (i*97)%256/16},i} );
+    if( i > 0 ) netlist.push_back({i-1, i});
+  }
+
+  auto legal = [](Placements const& p)
+  {
+    std::set<Cell> cells;
+    for( auto it{p.id_cbegin()}; it != p.id_cend(); ++it )
+    {
+      if( it->second.first < 0 || it->second.first > 15 ) return false;
+      if( it->second.second < 0 || it->second.second > 15 ) return false;
+      if( ! cells.insert(it->second).second ) return false;
+      if( p.at(it->second) != it->first ) return false;
+    }
+    return true;
+  };
+
+  auto length = [&](Placements const& p)
+  {
+    std::uint64_t total {0};
+    for( auto const& net : netlist )
+    {
+      auto l { *p.find(net[0]) }, r { *p.find(net[1]) };
+      total += std::abs(l.first - r.first) + std::abs(l.second - r.second);
+    }
+    return total;
+  };
+
+  REQUIRE( legal(placements) );
+  auto initial { length(placements) };
+
+  SECTION("Sequential")
+  {
+    electra::anneal::Options options;
+    options.seed = 1;
+    options.sweeps = 200;
+
+    auto report { electra::anneal::anneal(placements, netlist, Cell{0,0}, Cell{15,15}, options) };
+
+    REQUIRE( legal(placements) );
+    REQUIRE( placements.size() == 64 );
+    REQUIRE( report.wirelength == length(placements) );
+    REQUIRE( report.wirelength < initial );
+    REQUIRE( report.moves == 200*64 );
+    REQUIRE( report.accepted <= report.moves );
+    REQUIRE( report.moves_per_second > 0 );
+  }
+
+  SECTION("Deterministic")
+  {
+    electra::anneal::Options options;
+    options.seed = 3;
+    options.sweeps = 50;
+    options.threads = 4;
+    options.replicas = 3;
+    options.range = 4;
+    options.area_weight = 0.5;
+
+    Placements other;
+    for( auto it{placements.id_cbegin()}; it != placements.id_cend(); ++it )
+    {
+      other.insert( {it->second, it->first} );
+    }
+
+    auto r1 { electra::anneal::anneal(placements, netlist, Cell{0,0}, Cell{15,15}, options) };
+    // Stripes run on a pool, the result does not depend on it
+    electra::executor::Pool pool(4);
+    auto r2 { electra::anneal::anneal(other, netlist, Cell{0,0}, Cell{15,15}, options, &pool) };
+
+    REQUIRE( legal(placements) );
+    REQUIRE( r1.cost == r2.cost );
+    REQUIRE( r1.exchanges == r2.exchanges );
+    REQUIRE( r1.wirelength < initial );
+    compare(placements.id_cbegin(), placements.id_cend(), other.id_cbegin());
+  }
+}
@@ -70,4 +70,30 @@ TEST_CASE("Area", "[area]")
     REQUIRE(area.first == 1);
     REQUIRE(area.second == 4);
   }
+
+  SECTION("Batch")
+  {
+    using Cell = std::pair<int64_t,int64_t>;
+
+    // Dense coordinates use a histogram, sparse ones are sorted
+    std::vector<Cell> dense { {0,0},{1,0},{1,1},{2,1},{2,2},{1,0} };
+    std::vector<Cell> sparse { {-1'000'000,0},{3,5'000'000},{3,0} };
+
+    electra::area::Area<int64_t> single;
+    single.insert(dense);
+    single.insert(sparse);
+
+    electra::area::Area<int64_t> area;
+    area.insert(dense.cbegin(), dense.cend());
+    area.insert(sparse.cbegin(), sparse.cend());
+
+    REQUIRE( area.get_bounds() == single.get_bounds() );
+    REQUIRE( nlohmann::json(area) == nlohmann::json(single) );
+
+    area.erase(sparse.cbegin(), sparse.cend());
+    single.erase(sparse);
+
+    REQUIRE( area.get_area() == std::make_pair(int64_t{3}, int64_t{3}) );
+    REQUIRE( nlohmann::json(area) == nlohmann::json(single) );
+  }
 }
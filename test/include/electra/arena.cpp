@@ -0,0 +1,111 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : arena
+// @created     : Thursday Oct 22, 2026 15:47:10 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <electra/arena.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+
+TEST_CASE("Arena", "[arena]")
+{
+  using Cell = std::pair<int32_t,int32_t>;
+  using Path = std::vector<Cell>;
+
+  //
+  // Counts the live allocations taken from it
+  //
+  struct Counting : std::pmr::memory_resource
+  {
+    std::int64_t live {0};
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+      ++live;
+      return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+      --live;
+      std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+    {
+      return this == &other;
+    }
+  };
+
+  SECTION("Memory Resource")
+  {
+    Counting counting;
+
+    {
+      electra::placement::Placements<int32_t> placements(&counting);
+      electra::wire::Wires<int32_t> wires(&counting);
+
+      auto before { counting.live };
+
+      placements.insert( {{0,0},1} );
+      placements.insert( {{1,4},2} );
+      wires.insert( Path{{0,0},{1,0},{2,0},{2,1}} );
+
+      REQUIRE( counting.live > before );
+
+      REQUIRE( wires.split({0,0},{2,1},{2,0}) );
+      REQUIRE( wires.join({2,0}) );
+
+      placements.erase(1);
+      REQUIRE( placements.get_area() == Cell{1,1} );
+    }
+
+    REQUIRE( counting.live == 0 );
+  }
+
+  SECTION("Encoding")
+  {
+    Counting counting;
+    Path path {{0,0},{0,1},{0,2},{1,2}};
+
+    {
+      auto encoded { electra::wire::encode(path.cbegin(), path.cend(),
+        std::pmr::polymorphic_allocator<Cell>(&counting)) };
+      REQUIRE( counting.live == 1 );
+
+      auto decoded { electra::wire::decode(encoded.cbegin(), encoded.cend()) };
+      compare(decoded.cbegin(), decoded.cend(), path.cbegin());
+    }
+
+    REQUIRE( counting.live == 0 );
+  }
+
+  SECTION("Throwaway Layouts")
+  {
+    electra::arena::Arena arena;
+
+    for( int32_t k{0}; k < 4; ++k )
+    {
+      {
+        electra::placement::Placements<int32_t> placements(&arena);
+        electra::wire::Wires<int32_t> wires(&arena);
+
+        for( int32_t i{0}; i < 100; ++i )
+        {
+          placements.insert( {{i,k},i} );
+          wires.insert( Path{{i,k},{i,k+1},{i+1,k+1}} );
+        }
+
+        REQUIRE( placements.size() == 100 );
+        REQUIRE( *placements.find(42) == Cell{42,k} );
+        REQUIRE( wires.find(Cell{7,k},Cell{8,k+1}) );
+        REQUIRE( arena.allocated() > 0 );
+      }
+
+      arena.release();
+      REQUIRE( arena.allocated() == 0 );
+    }
+  }
+}
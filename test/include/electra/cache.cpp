@@ -0,0 +1,65 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : cache
+// @created     : Wednesday Oct 21, 2026 16:58:40 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <electra/cache.hpp>
+
+TEST_CASE("Cache", "[cache]")
+{
+  using electra::cache::Key;
+
+  electra::cache::Cache<int> cache(2);
+
+  SECTION("Least Recently Used")
+  {
+    cache.insert(Key{1,0}, 10);
+    cache.insert(Key{2,0}, 20);
+
+    REQUIRE( *cache.find(Key{1,0}) == 10 );
+
+    // The entry of key 2 is the least recently used
+    cache.insert(Key{3,0}, 30);
+
+    REQUIRE( cache.size() == 2 );
+    REQUIRE( cache.find(Key{2,0}) == nullptr );
+    REQUIRE( *cache.find(Key{1,0}) == 10 );
+    REQUIRE( *cache.find(Key{3,0}) == 30 );
+    REQUIRE( cache.hits() == 3 );
+    REQUIRE( cache.misses() == 1 );
+
+    cache.erase(Key{1,0});
+    REQUIRE( cache.size() == 1 );
+    cache.clear();
+    REQUIRE( cache.size() == 0 );
+  }
+
+  SECTION("Layouts")
+  {
+    electra::placement::Placements<int32_t> placements;
+    electra::wire::Wires<int32_t> wires;
+
+    placements.insert( {{0,0},1} );
+    placements.insert( {{2,0},2} );
+    wires.insert( {{0,0},{1,0},{2,0}} );
+
+    int evaluations {0};
+    auto evaluate = [&] { ++evaluations; return static_cast<int>(placements.size()); };
+
+    REQUIRE( cache.memoize(electra::cache::key(placements, wires), evaluate) == 2 );
+
+    placements.move( {{0,1},1} );
+    REQUIRE( cache.memoize(electra::cache::key(placements, wires), evaluate) == 2 );
+    REQUIRE( evaluations == 2 );
+
+    // Back to the first layout
+    placements.move( {{0,0},1} );
+    REQUIRE( cache.memoize(electra::cache::key(placements, wires), evaluate) == 2 );
+    REQUIRE( evaluations == 2 );
+  }
+}
@@ -0,0 +1,256 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : density
+// @created     : Monday Oct 19, 2026 11:02:15 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <limits>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+
+#include <electra/density.hpp>
+#include <electra/layout.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+
+//
+// Whether a container can enable its density map or occupancy
+//
+template<typename C, typename = void>
+struct has_density : std::false_type {};
+template<typename C>
+struct has_density<C, std::void_t<decltype(std::declval<C&>().enable_density())>> : std::true_type {};
+
+template<typename C, typename = void>
+struct has_occupancy : std::false_type {};
+template<typename C>
+struct has_occupancy<C, std::void_t<decltype(std::declval<C&>().enable_occupancy())>> : std::true_type {};
+
+TEST_CASE("Density", "[density]")
+{
+  using Density = electra::density::Density<int32_t>;
+
+  Density density;
+
+  SECTION("Rectangle Counts")
+  {
+    REQUIRE( density.count({-100,-100},{100,100}) == 0 );
+
+    density.insert({{0,0},{1,0},{2,0},{0,5},{-3,-7},{12,9}});
+
+    REQUIRE( density.count({-100,-100},{100,100}) == 6 );
+    REQUIRE( density.count({0,0},{2,0}) == 3 );
+    REQUIRE( density.count({2,0},{0,0}) == 3 );
+    REQUIRE( density.count({0,0},{7,7}) == 4 );
+    REQUIRE( density.count({-3,-7},{-3,-7}) == 1 );
+    REQUIRE( density.count({13,10},{100,100}) == 0 );
+    REQUIRE( density.at({1,0}) == 1 );
+
+    density.erase({{1,0},{12,9}});
+
+    REQUIRE( density.count({-100,-100},{100,100}) == 4 );
+    REQUIRE( density.count({0,0},{2,0}) == 2 );
+
+    // Erasing cells that are not tracked is ignored
+    density.erase({{1,0},{500,500}});
+
+    REQUIRE( density.count({-100,-100},{100,100}) == 4 );
+  }
+
+  SECTION("Brute Force")
+  {
+    std::vector<std::pair<int32_t,int32_t>> cells;
+    for( int32_t i{0}; i < 40; ++i )
+    {
+      cells.emplace_back((i*7)%23 - 5, (i*11)%17 - 3);
+    }
+    density.insert(cells);
+
+    for( int32_t x{-6}; x < 20; x += 3 )
+    {
+      for( int32_t y{-4}; y < 15; y += 2 )
+      {
+        auto expected { std::count_if(cells.cbegin(), cells.cend(),
+          [&](auto const& c){ return c.first >= x && c.first <= x+5
+            && c.second >= y && c.second <= y+4; }) };
+        REQUIRE( density.count({x,y},{x+5,y+4}) == expected );
+      }
+    }
+  }
+
+  SECTION("Dense Tiles")
+  {
+    // Enough cells in one tile to switch it to a Fenwick tree
+    std::vector<std::pair<int32_t,int32_t>> cells;
+    for( int32_t i{0}; i < 1500; ++i )
+    {
+      cells.emplace_back((i*37)%70 - 3, (i*53)%67 - 2);
+    }
+    density.insert(cells);
+
+    auto check = [&]
+    {
+      for( int32_t x{-5}; x < 70; x += 7 )
+      {
+        for( int32_t y{-4}; y < 70; y += 5 )
+        {
+          auto expected { std::count_if(cells.cbegin(), cells.cend(),
+            [&](auto const& c){ return c.first >= x && c.first <= x+20
+              && c.second >= y && c.second <= y+9; }) };
+          REQUIRE( density.count({x,y},{x+20,y+9}) == expected );
+        }
+      }
+    };
+
+    check();
+
+    // Back below the limit, tiles return to sorted arrays
+    density.erase(std::vector<std::pair<int32_t,int32_t>>(cells.cbegin()+100, cells.cend()));
+    cells.resize(100);
+
+    check();
+  }
+
+  SECTION("Sparse Grid")
+  {
+    // Memory follows the occupied tiles, not the bounding box
+    density.insert({{0,0},{100'000,100'000}});
+
+    REQUIRE( density.memory_usage().total() < 4096 );
+    REQUIRE( density.count({0,0},{100'000,100'000}) == 2 );
+    REQUIRE( density.count({1,1},{100'000,100'000}) == 1 );
+
+    // Each far apart tile adds at most 26x26 nodes to the tree
+    REQUIRE( density.memory_usage().total() < 2 * 26 * 26 * 64 );
+
+    auto min { std::numeric_limits<int32_t>::min() };
+    auto max { std::numeric_limits<int32_t>::max() };
+    density.insert({{min,min},{max,max}});
+
+    REQUIRE( density.count({min,min},{max,max}) == 4 );
+    REQUIRE( density.count({max,max},{max,max}) == 1 );
+    REQUIRE( density.at({min,min}) == 1 );
+  }
+
+  SECTION("Large Rectangles")
+  {
+    // Spread over many tiles, so the whole ones come from the tree
+    std::vector<std::pair<int32_t,int32_t>> cells;
+    for( int32_t i{0}; i < 3000; ++i )
+    {
+      cells.emplace_back((i*7919)%3001 - 1500, (i*104729)%2003 - 1000);
+    }
+    density.insert(cells);
+
+    auto check = [&]
+    {
+      for( int32_t k{0}; k < 40; ++k )
+      {
+        std::pair<int32_t,int32_t> a { (k*379)%1700 - 1600, (k*211)%1100 - 1050 };
+        std::pair<int32_t,int32_t> b { a.first + 300 + (k*97)%1500, a.second + 200 + (k*53)%1000 };
+        auto expected { std::count_if(cells.cbegin(), cells.cend(),
+          [&](auto const& c){ return c.first >= a.first && c.first <= b.first
+            && c.second >= a.second && c.second <= b.second; }) };
+        REQUIRE( density.count(a,b) == expected );
+      }
+      REQUIRE( density.count({-64,-64},{1663,1663})
+        == std::count_if(cells.cbegin(), cells.cend(), [](auto const& c)
+          { return c.first >= -64 && c.first <= 1663 && c.second >= -64 && c.second <= 1663; }) );
+    };
+
+    check();
+
+    // Changes between counts reach the tree
+    density.erase(std::vector<std::pair<int32_t,int32_t>>(cells.cbegin(), cells.cbegin()+1000));
+    cells.erase(cells.begin(), cells.begin()+1000);
+    check();
+
+    auto min { std::numeric_limits<int32_t>::min() };
+    auto max { std::numeric_limits<int32_t>::max() };
+    density.insert({{min,min},{max,max}});
+    REQUIRE( density.count({min,min},{max,max}) == 2002 );
+    REQUIRE( density.count({min+1,min},{max,max}) == 2001 );
+  }
+
+  SECTION("Heatmap")
+  {
+    density.insert({{0,0},{1,1},{2,2},{3,3}});
+
+    auto buckets { density.heatmap(2,2) };
+
+    int64_t total{0};
+    for( auto const& bucket : buckets ) total += bucket.count;
+
+    REQUIRE( total == 4 );
+    REQUIRE( buckets.size() == 2 );
+    REQUIRE( buckets.front().count == 2 );
+
+    // Far apart cells only yield the buckets holding them
+    density.insert({{2'000'000,2'000'000}});
+
+    for( auto side : {std::size_t{8}, std::size_t{64}, std::size_t{128}} )
+    {
+      auto sparse { density.heatmap(side,side) };
+      REQUIRE( ! sparse.empty() );
+      REQUIRE( sparse.size() <= 3 );
+      REQUIRE( sparse.back().count == 1 );
+      REQUIRE( sparse.back().column == sparse.back().row );
+      REQUIRE( sparse.back().column > 2'000'000 / side - 2 );
+    }
+  }
+
+  SECTION("Placements and Wires")
+  {
+    electra::placement::Placements<int32_t> placements;
+    electra::wire::Wires<int32_t> wires;
+
+    REQUIRE_FALSE( placements.get_density() );
+
+    placements.insert( {{0,0},1} );
+    placements.enable_density();
+    placements.insert( {{3,3},2} );
+
+    REQUIRE( placements.get_density()->count({0,0},{3,3}) == 2 );
+
+    placements.erase(1);
+
+    REQUIRE( placements.get_density()->count({0,0},{3,3}) == 1 );
+
+    wires.enable_density();
+    wires.insert( {{0,0},{1,0},{2,0},{2,1}} );
+
+    REQUIRE( wires.get_density()->count({0,0},{2,1}) == 4 );
+
+    wires.truncate({0,0},{2,1},{1,0});
+
+    REQUIRE( wires.get_density()->count({0,0},{2,1}) == 2 );
+
+    wires.erase({0,0},{1,0});
+
+    REQUIRE( wires.get_density()->count({0,0},{2,1}) == 0 );
+  }
+
+  SECTION("Wide Coordinates")
+  {
+    // Tiles are keyed on 32 bits, wider containers can not keep them
+    static_assert( has_density<electra::placement::Placements<int32_t>>::value );
+    static_assert( has_occupancy<electra::wire::Wires<int32_t>>::value );
+    static_assert( has_occupancy<electra::layout::Layout<int32_t>>::value );
+    static_assert( ! has_density<electra::placement::Placements<int64_t>>::value );
+    static_assert( ! has_occupancy<electra::placement::Placements<int64_t>>::value );
+    static_assert( ! has_density<electra::wire::Wires<int64_t>>::value );
+    static_assert( ! has_occupancy<electra::wire::Wires<int64_t>>::value );
+    static_assert( ! has_occupancy<electra::layout::Layout<int64_t>>::value );
+
+    electra::placement::Placements<int64_t> placements;
+    placements.insert( {{int64_t{1} << 32, 0}, 1} );
+    REQUIRE_FALSE( placements.get_density() );
+    REQUIRE_FALSE( placements.get_occupancy() );
+  }
+}
@@ -0,0 +1,202 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : distance
+// @created     : Tuesday Oct 20, 2026 10:44:18 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <electra/distance.hpp>
+#include <set>
+
+TEST_CASE("Distance", "[distance]")
+{
+  using Field = electra::distance::Field<int32_t>;
+  using Cell = std::pair<int32_t,int32_t>;
+
+  SECTION("Nearest Free Cell")
+  {
+    Field field({0,0},{9,9});
+
+    REQUIRE( field.nearest({4,4}) == Cell{4,4} );
+
+    // Block a 3x3 square around (4,4)
+    std::vector<Cell> block;
+    for( int32_t x{3}; x <= 5; ++x )
+      for( int32_t y{3}; y <= 5; ++y )
+        block.emplace_back(x,y);
+    field.insert(block);
+
+    auto cell { field.nearest({4,4}) };
+
+    REQUIRE( cell );
+    REQUIRE( std::abs(cell->first-4) + std::abs(cell->second-4) == 2 );
+    REQUIRE_FALSE( field.occupied(*cell) );
+
+    // Queries outside of the window
+    REQUIRE( field.nearest({-5,4}) == Cell{0,4} );
+    REQUIRE( field.nearest({20,20}) == Cell{9,9} );
+
+    field.erase({{4,3}});
+
+    REQUIRE( field.nearest({4,4}) == Cell{4,3} );
+  }
+
+  SECTION("Words Boundaries")
+  {
+    // Full rows longer than a word, with a single free cell
+    Field field({0,0},{199,2});
+
+    std::vector<Cell> cells;
+    for( int32_t x{0}; x < 200; ++x )
+      for( int32_t y{0}; y < 3; ++y )
+        if( !(x == 130 && y == 1) ) cells.emplace_back(x,y);
+    field.insert(cells);
+
+    REQUIRE( field.nearest({0,0}) == Cell{130,1} );
+    REQUIRE( field.nearest({199,2}) == Cell{130,1} );
+    REQUIRE( *field.distance({0,0}) == 131 );
+    REQUIRE( *field.distance({63,1}) == 67 );
+
+    field.insert({{130,1}});
+
+    REQUIRE_FALSE( field.nearest({0,0}) );
+    REQUIRE_FALSE( field.distance({0,0}) );
+  }
+
+  SECTION("Distance Field")
+  {
+    Field field({0,0},{99,49});
+
+    std::vector<Cell> cells;
+    for( int32_t x{0}; x < 100; ++x )
+      for( int32_t y{0}; y < 50; ++y )
+        if( (x*31 + y*17) % 7 != 0 ) cells.emplace_back(x,y);
+    field.insert(cells);
+
+    // Compare against a brute force search
+    for( int32_t x{0}; x < 100; x += 7 )
+    {
+      for( int32_t y{0}; y < 50; y += 3 )
+      {
+        int32_t expected { std::numeric_limits<int32_t>::max() };
+        for( int32_t i{0}; i < 100; ++i )
+          for( int32_t j{0}; j < 50; ++j )
+            if( ! field.occupied({i,j}) )
+              expected = std::min(expected, std::abs(i-x) + std::abs(j-y));
+
+        REQUIRE( static_cast<int32_t>(*field.distance({x,y})) == expected );
+
+        auto cell { field.nearest({x,y}) };
+        REQUIRE( std::abs(cell->first-x) + std::abs(cell->second-y) == expected );
+      }
+    }
+
+    // Freeing cells keeps the field up to date
+    field.erase({{50,25}});
+
+    REQUIRE( *field.distance({50,25}) == 0 );
+    REQUIRE( *field.distance({51,25}) <= 1 );
+  }
+
+  SECTION("Incremental Updates")
+  {
+    Field field({0,0},{39,29});
+
+    std::vector<Cell> cells;
+    for( int32_t x{0}; x < 40; ++x )
+      for( int32_t y{0}; y < 30; ++y )
+        if( (x*13 + y*7) % 5 != 0 ) cells.emplace_back(x,y);
+    field.insert(cells);
+
+    REQUIRE( field.distance({0,0}) );
+
+    //
+    // Occupy and free cells between queries, the field matches
+    // one built from scratch with the same cells
+    //
+    auto matches = [&]
+    {
+      Field fresh({0,0},{39,29});
+      std::vector<Cell> occupied;
+      for( int32_t x{0}; x < 40; ++x )
+        for( int32_t y{0}; y < 30; ++y )
+          if( field.occupied({x,y}) ) occupied.emplace_back(x,y);
+      fresh.insert(occupied);
+
+      for( int32_t x{0}; x < 40; ++x )
+        for( int32_t y{0}; y < 30; ++y )
+          if( field.distance({x,y}) != fresh.distance({x,y}) ) return false;
+      return true;
+    };
+
+    for( int32_t k{0}; k < 200; ++k )
+    {
+      Cell cell { (k*17) % 40, (k*11) % 30 };
+      if( k % 3 == 2 ) field.erase({cell});
+      else field.insert({cell});
+      REQUIRE( matches() );
+    }
+
+    // Down to no free cell at all, and back to a single one
+    std::vector<Cell> all;
+    for( int32_t x{0}; x < 40; ++x )
+      for( int32_t y{0}; y < 30; ++y )
+        if( ! field.occupied({x,y}) ) all.emplace_back(x,y);
+    for( auto const& cell : all ) field.insert({cell});
+
+    REQUIRE_FALSE( field.distance({20,15}) );
+
+    field.erase({{39,29}});
+
+    REQUIRE( *field.distance({0,0}) == 68 );
+    REQUIRE( matches() );
+  }
+
+  SECTION("Batched Queries")
+  {
+    Field field({0,0},{9,0});
+
+    field.insert({{3,0},{4,0},{5,0}});
+
+    std::vector<Cell> queries {{4,0},{4,0},{4,0}};
+    std::vector<std::optional<Cell>> results;
+
+    field.nearest(queries.cbegin(), queries.cend(), std::back_inserter(results));
+
+    REQUIRE( results.size() == 3 );
+    REQUIRE( results.at(0) == results.at(2) );
+
+    results.clear();
+    field.claim(queries.cbegin(), queries.cend(), std::back_inserter(results));
+
+    std::set<Cell> claimed;
+    for( auto const& r : results ) claimed.insert(*r);
+
+    REQUIRE( claimed.size() == 3 );
+    REQUIRE( field.occupied(*results.at(0)) );
+  }
+
+  SECTION("Placements and Wires")
+  {
+    electra::placement::Placements<int32_t> placements;
+    electra::wire::Wires<int32_t> wires;
+
+    placements.insert( {{1,1},1} );
+    wires.insert( {{0,1},{1,1},{2,1}} );
+
+    Field field({0,0},{2,2});
+    field.load(placements);
+    field.load(wires);
+
+    REQUIRE( field.occupied({0,1}) );
+
+    // The crossing cell stays occupied by the placement
+    field.erase({{0,1},{1,1},{2,1}});
+
+    REQUIRE( field.occupied({1,1}) );
+    REQUIRE_FALSE( field.occupied({2,1}) );
+  }
+}
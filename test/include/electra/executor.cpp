@@ -0,0 +1,157 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : executor
+// @created     : Friday Oct 30, 2026 11:40:18 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <atomic>
+#include <vector>
+#include <cstdio>
+#include <utility>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+#include <electra/executor.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+
+TEST_CASE("Executor", "[executor]")
+{
+  using namespace electra;
+  using Cell = std::pair<int32_t,int32_t>;
+
+  //
+  // Runs the tasks backwards, in place of a scheduler of the
+  // application
+  //
+  struct Reverse : executor::Executor
+  {
+    std::size_t calls {0};
+    void do_bulk(std::size_t count, executor::Task const& task) override
+    {
+      ++calls;
+      for( auto k{count}; k > 0; --k ) task(k - 1);
+    }
+    std::size_t do_concurrency() const noexcept override
+    {
+      return 2;
+    }
+  };
+
+  SECTION("Bulk")
+  {
+    executor::Pool pool(4);
+    REQUIRE( pool.concurrency() == 4 );
+
+    std::vector<std::atomic<int>> runs(10'000);
+    pool.bulk(runs.size(), [&](std::size_t k) { ++runs[k]; });
+
+    REQUIRE( std::all_of(runs.cbegin(), runs.cend(), [](auto const& r) { return r == 1; }) );
+  }
+
+  SECTION("Nested")
+  {
+    // Workers keep running jobs while they wait on a nested bulk
+    executor::Pool pool(3);
+    std::atomic<std::size_t> total {0};
+    pool.bulk(8, [&](std::size_t)
+    {
+      pool.bulk(100, [&](std::size_t k) { total += k; });
+    });
+
+    REQUIRE( total == 8 * 4950 );
+  }
+
+  SECTION("Grain")
+  {
+    executor::Pool pool(4);
+    std::vector<std::pair<std::size_t,std::size_t>> chunks(10);
+    executor::for_each(&pool, 95, 10, [&](std::size_t beg, std::size_t end)
+    {
+      chunks[beg / 10] = {beg, end};
+    });
+
+    REQUIRE( chunks.front() == std::make_pair(std::size_t{0}, std::size_t{10}) );
+    REQUIRE( chunks.back() == std::make_pair(std::size_t{90}, std::size_t{95}) );
+  }
+
+  SECTION("Sort")
+  {
+    std::vector<std::pair<int,int>> values;
+    for( int k{0}; k < 50'000; ++k ) values.emplace_back((k * 7919) % 101, k);
+    auto expected { values };
+    auto by_first = [](auto const& a, auto const& b) { return a.first < b.first; };
+    std::stable_sort(expected.begin(), expected.end(), by_first);
+
+    // Equal keys keep their order, whatever the chunks
+    executor::Pool pool(4);
+    for( std::size_t grain : {std::size_t{0}, std::size_t{1000}, std::size_t{7777}} )
+    {
+      auto sorted { values };
+      executor::sort(&pool, sorted.begin(), sorted.end(), by_first, grain);
+      REQUIRE( sorted == expected );
+    }
+  }
+
+  SECTION("Default")
+  {
+    Reverse reverse;
+    REQUIRE( executor::get_default()->concurrency() == 1 );
+
+    auto previous { executor::set_default(&reverse) };
+    placement::Placements<int32_t> placements;
+    for( int32_t k{0}; k < 2000; ++k ) placements.insert(std::make_pair(Cell{k % 50, k / 50}, k));
+    placements.enable_occupancy();
+    executor::set_default(previous);
+
+    REQUIRE( reverse.calls > 0 );
+    REQUIRE( placements.get_occupancy()->size() == 2000 );
+    REQUIRE( executor::get_default() == previous );
+  }
+
+  SECTION("Wires")
+  {
+    std::vector<std::vector<Cell>> list;
+    for( int32_t k{0}; k < 5000; ++k )
+    {
+      list.push_back({{0,k},{1,k},{2,k},{2,k+1},{3,k+1}});
+    }
+
+    executor::Pool pool(4);
+    Reverse reverse;
+    wire::Wires<int32_t> serial;
+    wire::Wires<int32_t> parallel;
+    wire::Wires<int32_t> external;
+    serial.insert(list.cbegin(), list.cend());
+    parallel.insert(list.cbegin(), list.cend(), &pool);
+    external.insert(list.cbegin(), list.cend(), &reverse);
+
+    REQUIRE( parallel.get_fingerprint() == serial.get_fingerprint() );
+    REQUIRE( external.get_fingerprint() == serial.get_fingerprint() );
+
+    serial.enable_occupancy();
+    serial.enable_density();
+    parallel.enable_occupancy(&pool);
+    parallel.enable_density(&pool);
+
+    REQUIRE( parallel.get_occupancy()->size() == serial.get_occupancy()->size() );
+    REQUIRE( parallel.get_density()->count({0,0},{3,5000})
+      == serial.get_density()->count({0,0},{3,5000}) );
+
+    // The document is the same on any executor
+    serial.write("executor_serial.json");
+    parallel.write("executor_parallel.json", &pool);
+    std::stringstream a, b;
+    a << std::ifstream("executor_serial.json").rdbuf();
+    b << std::ifstream("executor_parallel.json").rdbuf();
+    REQUIRE( a.str() == b.str() );
+    std::remove("executor_serial.json");
+    std::remove("executor_parallel.json");
+  }
+}
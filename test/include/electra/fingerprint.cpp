@@ -0,0 +1,91 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : fingerprint
+// @created     : Wednesday Oct 21, 2026 16:40:12 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <electra/fingerprint.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+
+TEST_CASE("Fingerprint", "[fingerprint]")
+{
+  using electra::fingerprint::Fingerprint;
+
+  SECTION("Placements")
+  {
+    electra::placement::Placements<int32_t> p1, p2;
+
+    REQUIRE( p1.get_fingerprint() == Fingerprint{} );
+
+    p1.insert( {{1,1},1} );
+    p1.insert( {{2,2},2} );
+    p1.insert( {{3,3},3} );
+
+    // Same layout from a different sequence of operations
+    p2.insert( {{3,3},3} );
+    p2.insert( {{5,5},1} );
+    p2.insert( {{2,2},2} );
+    p2.move( {{1,1},1} );
+
+    REQUIRE( p1.get_fingerprint() == p2.get_fingerprint() );
+
+    p2.move( {{1,2},1} );
+    REQUIRE( p1.get_fingerprint() != p2.get_fingerprint() );
+
+    // Swapping two ids changes the layout
+    p2.move( {{1,1},1} );
+    std::vector<std::pair<std::pair<int32_t,int32_t>,int32_t>> swap { {{2,2},3}, {{3,3},2} };
+    p2.move(swap.cbegin(), swap.cend());
+    REQUIRE( p1.get_fingerprint() != p2.get_fingerprint() );
+
+    p1.erase(1); p1.erase(2); p1.erase(3);
+    REQUIRE( p1.get_fingerprint() == Fingerprint{} );
+  }
+
+  SECTION("Wires")
+  {
+    electra::wire::Wires<int32_t> w1, w2;
+
+    w1.insert( {{0,0},{1,0},{2,0},{2,1},{2,2}} );
+    w1.insert( {{5,5},{5,6}} );
+
+    w2.insert( {{5,5},{5,6}} );
+    w2.insert( {{0,0},{1,0},{2,0},{2,1},{2,2}} );
+
+    REQUIRE( w1.get_fingerprint() == w2.get_fingerprint() );
+
+    REQUIRE( w2.split({0,0},{2,2},{2,0}) );
+    REQUIRE( w1.get_fingerprint() != w2.get_fingerprint() );
+    REQUIRE( w2.join({2,0}) );
+    REQUIRE( w1.get_fingerprint() == w2.get_fingerprint() );
+
+    REQUIRE( w2.replace({0,0},{2,2},{0,0},{2,2},
+      std::vector<std::pair<int32_t,int32_t>>{{0,0},{0,1},{0,2},{1,2},{2,2}}) );
+    REQUIRE( w1.get_fingerprint() != w2.get_fingerprint() );
+    REQUIRE( w2.replace({0,0},{2,2},{0,0},{2,2},
+      std::vector<std::pair<int32_t,int32_t>>{{0,0},{1,0},{2,0},{2,1},{2,2}}) );
+    REQUIRE( w1.get_fingerprint() == w2.get_fingerprint() );
+
+    REQUIRE( w2.truncate({0,0},{2,2},{2,0}) );
+    REQUIRE( w1.get_fingerprint() != w2.get_fingerprint() );
+
+    w1.erase({0,0},{2,2});
+    w2.erase({0,0},{2,0});
+    REQUIRE( w1.get_fingerprint() == w2.get_fingerprint() );
+
+    w1.erase({5,5},{5,6});
+    REQUIRE( w1.get_fingerprint() == Fingerprint{} );
+  }
+
+  SECTION("Combination")
+  {
+    Fingerprint a { 1, 2 }, b { 3, 4 };
+    REQUIRE( electra::fingerprint::combine(a,b) != electra::fingerprint::combine(b,a) );
+    REQUIRE( (a + b) - b == a );
+  }
+}
@@ -0,0 +1,193 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : hierarchy
+// @created     : Saturday Oct 24, 2026 16:05:09 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <vector>
+#include <optional>
+#include <utility>
+#include <cstdint>
+
+#include <electra/hierarchy.hpp>
+
+TEST_CASE("Hierarchical Layouts", "[hierarchy]")
+{
+  using namespace electra::hierarchy;
+
+  Hierarchy<int32_t> h;
+
+  //
+  // A sub-layout with two placements and a wire between them
+  //
+  auto cell { h.define() };
+  h.edit(cell).placements.insert( {{0,0},1} );
+  h.edit(cell).placements.insert( {{2,1},2} );
+  h.edit(cell).wires.insert( {{0,0},{1,0},{2,0},{2,1}} );
+
+  SECTION("Transforms")
+  {
+    Transform<int32_t> t {{10,5}, 1, true};
+
+    for( auto c : std::vector<std::pair<int32_t,int32_t>>{{0,0},{3,-2},{-1,7}} )
+    {
+      REQUIRE( t.invert(t.apply(c)) == c );
+    }
+
+    REQUIRE( Transform<int32_t>{{0,0},1,false}.apply({1,0}) == std::make_pair(0,1) );
+    REQUIRE( Transform<int32_t>{{0,0},0,true}.apply({1,0}) == std::make_pair(-1,0) );
+  }
+
+  SECTION("Instances")
+  {
+    REQUIRE( h.instantiate(0, cell, {{0,0}}) == 0u );
+    REQUIRE( h.instantiate(0, cell, {{10,0}}) == 1u );
+    REQUIRE( h.instantiate(0, cell, {{0,10}, 1}) == 2u );
+
+    REQUIRE( h.placements() == 6 );
+
+    auto hit { h.at({12,1}) };
+    REQUIRE( hit );
+    REQUIRE( hit->id == 2 );
+    REQUIRE( hit->path == Path{1} );
+    REQUIRE( h.find(*hit) == std::make_pair(12,1) );
+
+    // Rotated, (2,1) is mapped to (-1,12)
+    auto rotated { h.at({-1,12}) };
+    REQUIRE( rotated );
+    REQUIRE( rotated->path == Path{2} );
+    REQUIRE( rotated->id == 2 );
+
+    REQUIRE_FALSE( h.at({5,5}) );
+
+    REQUIRE( h.get_bounds() == std::make_pair(std::make_pair(-1,0), std::make_pair(12,12)) );
+    REQUIRE( h.get_area() == std::make_pair(14,13) );
+  }
+
+  SECTION("Nesting")
+  {
+    auto pair { h.define() };
+    h.instantiate(pair, cell, {{0,0}});
+    h.instantiate(pair, cell, {{4,0}});
+
+    for( int32_t k{0}; k < 3; ++k )
+    {
+      h.instantiate(0, pair, {{0,10*k}});
+    }
+
+    REQUIRE( h.placements() == 12 );
+
+    auto hit { h.at({6,21}) };
+    REQUIRE( hit );
+    REQUIRE( hit->path == Path{2,1} );
+    REQUIRE( hit->id == 2 );
+
+    // Cycles are rejected
+    REQUIRE_FALSE( h.instantiate(cell, pair, {}) );
+    REQUIRE_FALSE( h.instantiate(pair, pair, {}) );
+
+    // Edits are seen by every instance
+    h.edit(cell).placements.insert( {{1,3},3} );
+    REQUIRE( h.placements() == 18 );
+    REQUIRE( h.at({5,23}) );
+    REQUIRE( h.get_area() == std::make_pair(7,24) );
+  }
+
+  SECTION("Instance Grid")
+  {
+    // Rows of rotated and mirrored instances, and a large one over them
+    for( int32_t k{0}; k < 600; ++k )
+    {
+      h.instantiate(0, cell, {{(k%30)*4 - 20, (k/30)*3 - 10}, k%4, k%3 == 0});
+    }
+    auto wide { h.define() };
+    h.edit(wide).placements.insert( {{0,0},7} );
+    h.edit(wide).placements.insert( {{90,40},8} );
+    h.instantiate(0, wide, {{-25,-15}});
+    h.edit(0).placements.insert( {{-30,-30},9} );
+
+    //
+    // Matches a scan of the instances in order, the first
+    // instance holding the cell is the one found
+    //
+    auto const& top { h.get(0) };
+    for( int32_t x{-32}; x < 110; ++x )
+    {
+      for( int32_t y{-32}; y < 60; ++y )
+      {
+        std::optional<Hit<int32_t>> expected;
+        if( auto id {top.placements.at({x,y})} ) expected = Hit<int32_t>{{}, *id};
+        for( std::size_t i{0}; ! expected && i < top.instances.size(); ++i )
+        {
+          auto const& instance { top.instances[i] };
+          auto id { h.get(instance.definition).placements.at(instance.transform.invert({x,y})) };
+          if( id ) expected = Hit<int32_t>{{i}, *id};
+        }
+
+        auto hit { h.at({x,y}) };
+        REQUIRE( bool(hit) == bool(expected) );
+        if( ! hit ) continue;
+        REQUIRE( hit->path == expected->path );
+        REQUIRE( hit->id == expected->id );
+      }
+    }
+
+    // Edits rebuild the grid
+    h.edit(cell).placements.insert( {{1,1},3} );
+    auto hit { h.at({-3,-9}) };
+    REQUIRE( hit );
+    REQUIRE( hit->path == Path{4} );
+    REQUIRE( hit->id == 3 );
+  }
+
+  SECTION("Edits")
+  {
+    h.instantiate(0, cell, {{10,0}});
+
+    // Queries made while an edit is kept see each change
+    {
+      auto edit { h.edit(cell) };
+      REQUIRE_FALSE( h.at({15,5}) );
+
+      edit.placements.insert( {{5,5},4} );
+      auto hit { h.at({15,5}) };
+      REQUIRE( hit );
+      REQUIRE( hit->id == 4 );
+
+      edit.placements.erase(4);
+      REQUIRE_FALSE( h.at({15,5}) );
+
+      edit.wires.insert( {{0,0},{0,1},{0,2},{0,3},{0,4},{0,5},{0,6}} );
+    }
+
+    REQUIRE( h.get_bounds() == std::make_pair(std::make_pair(10,0), std::make_pair(12,6)) );
+  }
+
+  SECTION("Flatten")
+  {
+    h.edit(0).placements.insert( {{-5,-5},9} );
+    h.instantiate(0, cell, {{0,0}});
+    h.instantiate(0, cell, {{10,0}, 2, true});
+
+    electra::placement::Placements<int32_t> placements;
+    electra::wire::Wires<int32_t> wires;
+
+    h.flatten(placements, wires);
+
+    REQUIRE( placements.size() == h.placements() );
+    REQUIRE( wires.size() == 2 );
+    REQUIRE( placements.get_bounds() == h.get_bounds() );
+
+    h.for_each([&](auto const& region, auto, auto const&)
+    {
+      REQUIRE( placements.at(region) );
+    });
+
+    // Mirrored and rotated twice, (2,1) ends up at (12,-1)
+    REQUIRE( wires.find({10,0},{12,-1}) );
+  }
+}
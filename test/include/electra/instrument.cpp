@@ -0,0 +1,78 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : instrument
+// @created     : Tuesday Oct 27, 2026 17:02:55 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+#include <electra/instrument.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+
+TEST_CASE("Instrumentation", "[instrument]")
+{
+  using namespace electra;
+  using Cell = std::pair<int32_t,int32_t>;
+  using Wire = std::vector<Cell>;
+
+  placement::Placements<int32_t> placements;
+  wire::Wires<int32_t> wires;
+
+  placements.insert(std::make_pair(Cell{0,0}, 1));
+  placements.insert(std::make_pair(Cell{3,3}, 2));
+  REQUIRE( placements.at(Cell{0,0}) == 1 );
+  REQUIRE( placements.find(2) == Cell{3,3} );
+
+  wires.insert(Wire{{1,0},{2,0},{3,0},{3,1},{3,2}});
+  wires.insert(Wire{{5,5},{5,6}});
+  REQUIRE( wires.find(Cell{5,5}, Cell{5,6}) );
+  for( auto it{wires.cbegin()}; it != wires.cend(); ++it ) REQUIRE( it->size() > 1 );
+  wires.erase(Cell{1,0}, Cell{3,2});
+
+  SECTION("Counters")
+  {
+    auto p { placements.get_stats() };
+    auto w { wires.get_stats() };
+    auto a { placements.get_area_stats() };
+
+    if constexpr ( instrument::enabled )
+    {
+      REQUIRE( p.operations == 4 );
+      REQUIRE( p.probes == 6 );
+      REQUIRE( p.allocations > 0 );
+      REQUIRE( p.bytes > 0 );
+
+      // Two inserts, a find and an erase; the erase decodes
+      REQUIRE( w.operations == 4 );
+      REQUIRE( w.probes == 2 + 1 );
+      REQUIRE( w.decodes == 2 + 1 );
+      REQUIRE( w.cells == 5 + 2 + 5 );
+      REQUIRE( w.allocations > 0 );
+
+      REQUIRE( a.operations == 2 );
+      REQUIRE( a.probes == 4 );
+    }
+    else
+    {
+      REQUIRE( p.operations == 0 );
+      REQUIRE( w.decodes == 0 );
+      REQUIRE( a.probes == 0 );
+    }
+  }
+
+  SECTION("Json")
+  {
+    nlohmann::json j = wires.get_stats();
+
+    REQUIRE( j.at("operations") == wires.get_stats().operations );
+    REQUIRE( j.at("cells") == wires.get_stats().cells );
+    REQUIRE( j.size() == 7 );
+  }
+}
@@ -0,0 +1,174 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : layout
+// @created     : Sunday Oct 25, 2026 11:20:46 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <vector>
+#include <memory>
+#include <iterator>
+#include <cstdio>
+#include <utility>
+#include <cstdint>
+#include <fstream>
+
+#include <electra/layout.hpp>
+
+TEST_CASE("Unified Layouts", "[layout]")
+{
+  using Cell = std::pair<int32_t,int32_t>;
+  using Wire = std::vector<Cell>;
+
+  electra::layout::Layout<int32_t> layout;
+
+  SECTION("Shared Area")
+  {
+    REQUIRE( layout.place({0,0}, 1) );
+    auto id { layout.route(Wire{{1,0},{2,0},{3,0},{3,1},{3,2}}) };
+
+    REQUIRE( id == 2 );
+    REQUIRE( layout.size() == 2 );
+
+    // A single area, seen by both containers
+    REQUIRE( layout.get_area() == Cell{4,3} );
+    REQUIRE( layout.get_placements().get_area() == Cell{4,3} );
+    REQUIRE( layout.get_wires().get_area() == Cell{4,3} );
+    REQUIRE( layout.get_bounds() == std::make_pair(Cell{0,0}, Cell{3,2}) );
+
+    REQUIRE( layout.erase(2) );
+    REQUIRE( layout.get_area() == Cell{1,1} );
+    REQUIRE( layout.erase(1) );
+    REQUIRE( layout.get_area() == Cell{0,0} );
+    REQUIRE_FALSE( layout.erase(1) );
+  }
+
+  SECTION("Id Space")
+  {
+    REQUIRE( layout.place({0,0}, 5) );
+    auto id { layout.route(Wire{{1,0},{2,0}}) };
+
+    REQUIRE( id == 6 );
+    REQUIRE( layout.find_wire(6) == std::make_pair(Cell{1,0}, Cell{2,0}) );
+    REQUIRE_FALSE( layout.place({9,9}, 6) );
+    REQUIRE_FALSE( layout.place({9,9}, 5) );
+    REQUIRE( layout.contains(5) );
+    REQUIRE( layout.contains(6) );
+    REQUIRE( layout.at({0,0}) == 5 );
+    REQUIRE( layout.find(5) == Cell{0,0} );
+    REQUIRE_FALSE( layout.find(6) );
+    REQUIRE_FALSE( layout.route(Wire{}) );
+
+    // Wires with the same endpoints keep their own ids
+    auto other { layout.route(Wire{{1,0},{1,1},{2,1},{2,0}}) };
+    REQUIRE( layout.erase(6) );
+    REQUIRE( layout.find_wire(*other) == std::make_pair(Cell{1,0}, Cell{2,0}) );
+    REQUIRE( layout.get_wires().get_area() == Cell{3,2} );
+  }
+
+  SECTION("Shared Occupancy")
+  {
+    layout.place({0,0}, 1);
+    layout.route(Wire{{1,0},{2,0}});
+    layout.enable_occupancy();
+
+    auto occupancy { layout.get_occupancy() };
+
+    REQUIRE( occupancy );
+    REQUIRE( occupancy == layout.get_placements().get_occupancy() );
+    REQUIRE( occupancy == layout.get_wires().get_occupancy() );
+    REQUIRE( occupancy->size() == 3 );
+
+    layout.route(Wire{{0,1},{0,2}});
+    REQUIRE( occupancy->contains({0,2}) );
+    REQUIRE( occupancy->size() == 5 );
+  }
+
+  SECTION("Batches")
+  {
+    layout.enable_occupancy();
+
+    std::vector<std::pair<Cell,int32_t>> regions;
+    for( int32_t k{0}; k < 64; ++k ) regions.push_back({{(k*37)%64, k%8}, k});
+    regions.push_back({{100,100}, 3});
+
+    REQUIRE( layout.place(regions.cbegin(), regions.cend()) == 64 );
+
+    std::vector<Wire> wires { {{0,10},{1,10},{2,10}}, {{5,10},{5,11}} };
+    auto ids { layout.route(wires.cbegin(), wires.cend()) };
+
+    REQUIRE( ids == std::vector<int32_t>{64,65} );
+    REQUIRE( layout.get_occupancy()->size() == 69 );
+    REQUIRE( layout.get_occupancy()->contains({5,11}) );
+
+    std::vector<int32_t> erased { 0, 1, 64, 99 };
+    REQUIRE( layout.erase(erased.cbegin(), erased.cend()) == 3 );
+    REQUIRE( layout.get_occupancy()->size() == 64 );
+    REQUIRE_FALSE( layout.get_occupancy()->contains({0,0}) );
+    REQUIRE_FALSE( layout.get_occupancy()->contains({1,10}) );
+    REQUIRE( layout.size() == 63 );
+
+    // The occupancy is attached again after the batch
+    REQUIRE( layout.erase(65) );
+    REQUIRE( layout.get_occupancy()->size() == 62 );
+
+    // Moved wires still reach the occupancy
+    std::vector<Wire> moved { {{0,20},{1,20}}, {{3,20},{3,21},{3,22}} };
+    ids = layout.route(std::make_move_iterator(moved.begin()), std::make_move_iterator(moved.end()));
+
+    REQUIRE( ids.size() == 2 );
+    REQUIRE( layout.get_occupancy()->size() == 67 );
+    REQUIRE( layout.get_occupancy()->contains({3,22}) );
+    REQUIRE( layout.find_wire(ids.back()) );
+  }
+
+  SECTION("Read Back")
+  {
+    // Containers sharing their area and occupancy, as in a layout
+    auto area { std::make_shared<electra::area::Area<int32_t>>() };
+    auto occupancy { std::make_shared<electra::occupancy::Occupancy<int32_t>>() };
+    electra::placement::Placements<int32_t> placements;
+    electra::wire::Wires<int32_t> wires;
+    placements.attach_area(area);
+    placements.attach_occupancy(occupancy);
+    wires.attach_area(area);
+    wires.attach_occupancy(occupancy);
+
+    placements.insert( {{0,0},1} );
+    placements.insert( {{4,1},2} );
+    wires.insert( Wire{{0,5},{1,5},{2,5}} );
+
+    placements.write("layout_");
+    wires.write("layout_wires.json");
+
+    placements.erase(2);
+    placements.insert( {{9,9},3} );
+    placements.read("layout_");
+
+    // The cells of the wires are kept, the ones of the edits dropped
+    REQUIRE( area->get_area() == Cell{5,6} );
+    REQUIRE( placements.get_occupancy() == occupancy.get() );
+    REQUIRE( occupancy->size() == 5 );
+    REQUIRE( occupancy->contains({1,5}) );
+    REQUIRE_FALSE( occupancy->contains({9,9}) );
+
+    wires.read("layout_wires.json");
+
+    REQUIRE( wires.get_occupancy() == occupancy.get() );
+    REQUIRE( occupancy->size() == 5 );
+    REQUIRE( area->get_area() == Cell{5,6} );
+
+    // Only the cells of the placements are written with them
+    nlohmann::json j;
+    std::ifstream("layout_area.json") >> j;
+    REQUIRE( j.get<electra::area::Area<int32_t>>().get_area() == Cell{5,2} );
+
+    for( auto file : {"layout_pid.json", "layout_idp.json", "layout_area.json", "layout_wires.json"} )
+    {
+      std::remove(file);
+    }
+  }
+}
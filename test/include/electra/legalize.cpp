@@ -0,0 +1,110 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : legalize
+// @created     : Tuesday Oct 20, 2026 16:02:44 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <electra/legalize.hpp>
+#include <set>
+
+TEST_CASE("Legalize", "[legalize]")
+{
+  using Placements = electra::placement::Placements<int32_t>;
+  using Cell = std::pair<int32_t,int32_t>;
+
+  Placements placements;
+
+  auto overlaps = [](Placements const& p)
+  {
+    std::set<Cell> cells;
+    for( auto it{p.id_cbegin()}; it != p.id_cend(); ++it )
+    {
+      if( ! cells.insert(it->second).second ) return true;
+    }
+    return false;
+  };
+
+  SECTION("Overlapping Placements")
+  {
+    placements.insert( {{2,2},1} );
+    placements.insert( {{2,2},2} );
+    placements.insert( {{2,2},3} );
+    placements.insert( {{7,0},4} );
+
+    REQUIRE( overlaps(placements) );
+
+    auto report { electra::legalize::legalize(placements, Cell{0,0}, Cell{9,4}) };
+
+    REQUIRE( report.legal );
+    REQUIRE_FALSE( overlaps(placements) );
+    REQUIRE( placements.size() == 4 );
+    REQUIRE( *placements.find(4) == Cell{7,0} );
+    REQUIRE( report.moved == 2 );
+    REQUIRE( report.total_displacement == 2 );
+
+    // Every placement can be found from its region
+    for( auto it{placements.id_cbegin()}; it != placements.id_cend(); ++it )
+    {
+      REQUIRE( placements.at(it->second) == it->first );
+    }
+  }
+
+  SECTION("Out of the Region")
+  {
+    placements.insert( {{-3,1},1} );
+    placements.insert( {{12,9},2} );
+
+    auto report { electra::legalize::legalize(placements, Cell{0,0}, Cell{9,4}) };
+
+    REQUIRE( report.legal );
+    REQUIRE( *placements.find(1) == Cell{0,1} );
+    REQUIRE( *placements.find(2) == Cell{9,4} );
+  }
+
+  SECTION("Full Region")
+  {
+    for( int32_t i{0}; i < 6; ++i ) placements.insert( {{0,0},i} );
+
+    REQUIRE_FALSE( electra::legalize::legalize(placements, Cell{0,0}, Cell{1,1}).legal );
+    REQUIRE( overlaps(placements) );
+
+    auto report { electra::legalize::legalize(placements, Cell{0,0}, Cell{2,1}) };
+
+    REQUIRE( report.legal );
+    REQUIRE_FALSE( overlaps(placements) );
+  }
+
+  SECTION("Row Bands")
+  {
+    for( int32_t i{0}; i < 400; ++i )
+    {
+      placements.insert( {{(i*13)%40, (i*7)%20},i} );
+    }
+
+    Placements pooled;
+    for( auto it{placements.id_cbegin()}; it != placements.id_cend(); ++it )
+    {
+      pooled.insert( {it->second, it->first} );
+    }
+
+    electra::legalize::Options options;
+    options.threads = 4;
+
+    auto report { electra::legalize::legalize(placements, Cell{0,0}, Cell{39,19}, options) };
+
+    REQUIRE( report.legal );
+    REQUIRE_FALSE( overlaps(placements) );
+    REQUIRE( placements.size() == 400 );
+
+    // Bands give the same placements on any executor
+    electra::executor::Pool pool(4);
+    auto other { electra::legalize::legalize(pooled, Cell{0,0}, Cell{39,19}, options, &pool) };
+
+    REQUIRE( other.total_displacement == report.total_displacement );
+    compare(placements.id_cbegin(), placements.id_cend(), pooled.id_cbegin());
+  }
+}
@@ -0,0 +1,172 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : memory
+// @created     : Thursday Oct 29, 2026 14:48:31 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+#include <electra/arena.hpp>
+#include <electra/memory.hpp>
+#include <electra/occupancy.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+#include <electra/layout.hpp>
+#include <electra/hierarchy.hpp>
+
+TEST_CASE("Memory usage", "[memory]")
+{
+  using namespace electra;
+  using Cell = std::pair<int32_t,int32_t>;
+  using Wire = std::vector<Cell>;
+
+  SECTION("Overhead")
+  {
+    arena::Arena arena;
+
+    REQUIRE( memory::overhead(0) == 4 * sizeof(void*) );
+    REQUIRE( (memory::overhead(100) + 100) % (2 * sizeof(void*)) == 0 );
+    REQUIRE( memory::overhead(100) >= sizeof(std::size_t) );
+    REQUIRE( memory::overhead(100, &arena) == 0 );
+  }
+
+  SECTION("Placements")
+  {
+    std::size_t const n { 1000 };
+    placement::Placements<int32_t> placements;
+    auto empty { placements.memory_usage() };
+
+    // Distinct columns and rows, each one an entry of the area
+    for( std::size_t k{0}; k < n; ++k )
+    {
+      auto v { static_cast<int32_t>(k) };
+      placements.insert(std::make_pair(Cell{v,v}, v));
+    }
+
+    auto usage { placements.memory_usage() };
+    auto entry { sizeof(std::pair<Cell const,int32_t>) + sizeof(std::pair<int32_t const,Cell>) };
+
+    REQUIRE( empty.payload == 0 );
+    REQUIRE( usage.payload == n * (entry + 2 * sizeof(std::pair<int32_t const,int32_t>)) );
+    REQUIRE( usage.index - empty.index == 4 * n * memory::NODE );
+    REQUIRE( usage.slack == 0 );
+    REQUIRE( usage.allocator > empty.allocator );
+    REQUIRE( usage.total() > usage.payload + usage.index );
+
+    placements.enable_occupancy();
+    REQUIRE( placements.memory_usage().total() > usage.total() );
+  }
+
+  SECTION("Wires")
+  {
+    wire::Wires<int32_t> wires;
+
+    for( int32_t k{0}; k < 100; ++k )
+    {
+      wires.insert(Wire{{0,k},{1,k},{2,k},{3,k},{3,k+1}});
+    }
+    for( int32_t k{0}; k < 90; ++k )
+    {
+      wires.erase(Cell{0,k}, Cell{3,k+1});
+    }
+
+    // The erased headers and the decoded cells remain reserved
+    auto usage { wires.memory_usage() };
+    REQUIRE( usage.slack > 0 );
+    REQUIRE( usage.index > 10 * sizeof(std::pmr::vector<Cell>) );
+
+    wires.shrink_to_fit();
+    auto shrunk { wires.memory_usage() };
+
+    REQUIRE( shrunk.slack == 0 );
+    REQUIRE( shrunk.payload == usage.payload );
+    REQUIRE( shrunk.total() < usage.total() );
+    REQUIRE( wires.size() == 10 );
+    REQUIRE( wires.find(Cell{0,95}, Cell{3,96}) );
+  }
+
+  SECTION("Occupancy")
+  {
+    occupancy::Occupancy<int32_t> occupancy;
+    std::vector<Cell> cells;
+    for( int32_t k{0}; k < 1000; ++k ) cells.emplace_back(k % 100, k / 100);
+
+    occupancy.insert(cells);
+    cells.resize(900);
+    occupancy.erase(cells);
+
+    REQUIRE( occupancy.memory_usage().slack > 0 );
+    occupancy.shrink_to_fit();
+    REQUIRE( occupancy.memory_usage().slack == 0 );
+    REQUIRE( occupancy.memory_usage().payload == 100 * sizeof(occupancy::Low) );
+    REQUIRE( occupancy.size() == 100 );
+  }
+
+  SECTION("Arena")
+  {
+    arena::Arena arena;
+    area::Area<int32_t> area(&arena);
+    area.insert(std::vector<Cell>{{0,0},{1,1},{2,2}});
+
+    REQUIRE( area.memory_usage().allocator == 0 );
+    REQUIRE( area.memory_usage().payload == 6 * sizeof(std::pair<int32_t const,int32_t>) );
+
+    // Buffers are left as they are, the arena would only grow
+    wire::Wires<int32_t> wires(&arena);
+    wires.insert(Wire{{0,0},{1,0},{2,0}});
+    wires.erase(Cell{0,0}, Cell{2,0});
+    auto bytes { arena.allocated() };
+    wires.shrink_to_fit();
+    REQUIRE( arena.allocated() == bytes );
+  }
+
+  SECTION("Layout")
+  {
+    layout::Layout<int32_t> layout;
+    layout.place(Cell{0,0}, 0);
+    layout.place(Cell{5,5}, 1);
+    layout.route(Wire{{1,0},{2,0},{3,0}});
+    layout.enable_occupancy();
+
+    auto usage { layout.memory_usage() };
+    auto separate { layout.get_placements().memory_usage() };
+    separate += layout.get_wires().memory_usage();
+
+    // The shared area and occupancy are counted once
+    REQUIRE( usage.total() > 0 );
+    REQUIRE( usage.payload < separate.payload );
+
+    layout.shrink_to_fit();
+    REQUIRE( layout.memory_usage().slack == 0 );
+    REQUIRE( layout.at(Cell{5,5}) == 1 );
+
+    nlohmann::json j = usage;
+    REQUIRE( j.at("total") == usage.total() );
+    REQUIRE( j.size() == 5 );
+  }
+
+  SECTION("Hierarchy")
+  {
+    hierarchy::Hierarchy<int32_t> hierarchy;
+    auto cell { hierarchy.define() };
+    hierarchy.edit(cell).placements.insert(std::make_pair(Cell{0,0}, 1));
+    auto empty { hierarchy.memory_usage() };
+
+    // Instances share the content of their definition
+    for( int32_t k{0}; k < 10; ++k )
+    {
+      hierarchy.instantiate(0, cell, {{k,0}, 0, false});
+    }
+    hierarchy.shrink_to_fit();
+
+    auto usage { hierarchy.memory_usage() };
+    REQUIRE( usage.payload - empty.payload == 10 * sizeof(hierarchy::Instance<int32_t>) );
+    REQUIRE( usage.slack == 0 );
+  }
+}
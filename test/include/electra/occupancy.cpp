@@ -0,0 +1,161 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : occupancy
+// @created     : Monday Oct 19, 2026 15:12:09 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <electra/occupancy.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+#include <set>
+
+TEST_CASE("Occupancy", "[occupancy]")
+{
+  using Occupancy = electra::occupancy::Occupancy<int32_t>;
+
+  Occupancy occupancy;
+
+  SECTION("Morton Codes")
+  {
+    for( auto c : std::vector<std::pair<int32_t,int32_t>>{{0,0},{-1,3},{70000,-5},{-80000,-90000}} )
+    {
+      auto code { electra::occupancy::encode(c) };
+      REQUIRE( electra::occupancy::decode<int32_t>(code) == c );
+    }
+
+    REQUIRE( electra::occupancy::encode(std::make_pair(-1,0))
+      < electra::occupancy::encode(std::make_pair(0,0)) );
+  }
+
+  SECTION("Membership")
+  {
+    occupancy.insert({{0,0},{1,0},{-300,700},{100000,100000}});
+
+    REQUIRE( occupancy.size() == 4 );
+    REQUIRE( occupancy.contains({-300,700}) );
+    REQUIRE( occupancy.contains({100000,100000}) );
+    REQUIRE_FALSE( occupancy.contains({2,0}) );
+
+    occupancy.erase({{1,0},{-300,700}});
+
+    REQUIRE( occupancy.size() == 2 );
+    REQUIRE_FALSE( occupancy.contains({1,0}) );
+  }
+
+  SECTION("Shared Cells")
+  {
+    // Two wires crossing in (1,1)
+    occupancy.insert({{1,0},{1,1},{1,2}});
+    occupancy.insert({{0,1},{1,1},{2,1}});
+
+    REQUIRE( occupancy.size() == 5 );
+
+    occupancy.erase({{1,0},{1,1},{1,2}});
+
+    REQUIRE( occupancy.contains({1,1}) );
+    REQUIRE( occupancy.size() == 3 );
+  }
+
+  SECTION("Dense Tiles")
+  {
+    std::vector<std::pair<int32_t,int32_t>> cells;
+    for( int32_t x{0}; x < 100; ++x )
+      for( int32_t y{0}; y < 100; ++y )
+        cells.emplace_back(x,y);
+
+    occupancy.insert(cells);
+
+    REQUIRE( occupancy.size() == 10000 );
+    for( auto const& c : cells ) REQUIRE( occupancy.contains(c) );
+
+    occupancy.erase(std::vector<std::pair<int32_t,int32_t>>(cells.begin(), cells.begin()+9000));
+
+    REQUIRE( occupancy.size() == 1000 );
+    REQUIRE_FALSE( occupancy.contains(cells.front()) );
+    REQUIRE( occupancy.contains(cells.back()) );
+  }
+
+  SECTION("Conversions")
+  {
+    // One chunk just past the array limit, held as a bitmap
+    std::vector<std::pair<int32_t,int32_t>> cells;
+    for( int32_t k{0}; k < 4097; ++k ) cells.emplace_back(k % 64, k / 64);
+    occupancy.insert(cells);
+
+    auto bitmap { occupancy.memory_usage().payload };
+
+    // Alternating edits at the limit keep the bitmap
+    for( int k{0}; k < 10; ++k )
+    {
+      occupancy.erase({cells.back()});
+      REQUIRE( occupancy.memory_usage().payload == bitmap );
+      occupancy.insert({cells.back()});
+      REQUIRE( occupancy.memory_usage().payload == bitmap );
+    }
+
+    // Still a bitmap until half the limit
+    occupancy.erase(std::vector<std::pair<int32_t,int32_t>>(cells.begin()+3000, cells.end()));
+    REQUIRE( occupancy.memory_usage().payload == bitmap );
+
+    // Back to an array at half the limit
+    occupancy.erase(std::vector<std::pair<int32_t,int32_t>>(cells.begin()+2048, cells.end()));
+    REQUIRE( occupancy.size() == 2048 );
+    REQUIRE( occupancy.memory_usage().payload < bitmap );
+    for( auto it{cells.begin()}; it != cells.begin()+2048; ++it ) REQUIRE( occupancy.contains(*it) );
+  }
+
+  SECTION("Set Operations")
+  {
+    auto region { Occupancy::region({-10,-10},{600,300}) };
+
+    REQUIRE( region.size() == 611*311 );
+    REQUIRE( region.contains({-10,300}) );
+    REQUIRE_FALSE( region.contains({601,0}) );
+
+    occupancy.insert({{0,0},{5,5},{700,700},{-10,-10}});
+
+    auto free { region - occupancy };
+
+    REQUIRE( free.size() == 611*311 - 3 );
+    REQUIRE_FALSE( free.contains({5,5}) );
+    REQUIRE( free.contains({5,6}) );
+
+    auto used { region & occupancy };
+
+    REQUIRE( used.size() == 3 );
+    REQUIRE_FALSE( used.contains({700,700}) );
+
+    auto all { free | occupancy };
+
+    REQUIRE( all.size() == 611*311 + 1 );
+
+    std::set<std::pair<int32_t,int32_t>> visited;
+    used.for_each([&](auto const& c){ visited.insert(c); });
+
+    REQUIRE( visited == std::set<std::pair<int32_t,int32_t>>{{0,0},{5,5},{-10,-10}} );
+  }
+
+  SECTION("Placements and Wires")
+  {
+    electra::placement::Placements<int32_t> placements;
+    electra::wire::Wires<int32_t> wires;
+
+    placements.enable_occupancy();
+    placements.insert( {{4,4},1} );
+
+    REQUIRE( placements.get_occupancy()->contains({4,4}) );
+
+    wires.insert( {{0,0},{1,0},{2,0}} );
+    wires.enable_occupancy();
+
+    REQUIRE( wires.get_occupancy()->size() == 3 );
+
+    wires.erase({0,0},{2,0});
+
+    REQUIRE( wires.get_occupancy()->empty() );
+  }
+}
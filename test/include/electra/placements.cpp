@@ -87,6 +87,96 @@ TEST_CASE("Placements testing unit", "[placements]")
     REQUIRE( placements.size() == 0 );
   }
 
+  SECTION("Batch")
+  {
+    // Repeated ids and cells, the first of each wins
+    std::vector<std::pair<std::pair<int32_t,int32_t>,int32_t>> entries
+      { {{5,5},1}, {{0,0},2}, {{2,7},3}, {{0,0},4}, {{9,1},1}, {{-3,4},5} };
+
+    Placements single;
+    single.enable_occupancy();
+    for( auto const& entry : entries ) single.insert(entry);
+
+    placements.enable_occupancy();
+    placements.insert(entries.cbegin(), entries.cend());
+
+    REQUIRE( placements.size() == single.size() );
+    REQUIRE( placements.get_fingerprint() == single.get_fingerprint() );
+    REQUIRE( placements.get_bounds() == single.get_bounds() );
+    REQUIRE( placements.get_occupancy()->size() == single.get_occupancy()->size() );
+    compare(placements.cbegin(), placements.cend(), single.cbegin());
+    compare(placements.id_cbegin(), placements.id_cend(), single.id_cbegin());
+
+    std::vector<int32_t> ids { 4, 1, 1, 7 };
+    for( auto id : ids ) single.erase(id);
+    placements.erase(ids.cbegin(), ids.cend());
+
+    REQUIRE( placements.size() == 3 );
+    REQUIRE( placements.get_fingerprint() == single.get_fingerprint() );
+    REQUIRE( placements.get_area() == single.get_area() );
+    REQUIRE( placements.get_occupancy()->size() == single.get_occupancy()->size() );
+    compare(placements.cbegin(), placements.cend(), single.cbegin());
+
+    // Large batches merged into existing placements, with repeats
+    entries.clear();
+    for( int32_t k{0}; k < 3000; ++k )
+    {
+      entries.push_back({{(k*37)%61 - 30, (k*53)%59 - 29}, (k*7)%2500 - 100});
+    }
+    for( auto const& entry : entries ) single.insert(entry);
+    placements.insert(entries.cbegin(), entries.cend());
+
+    REQUIRE( placements.size() == single.size() );
+    REQUIRE( placements.get_fingerprint() == single.get_fingerprint() );
+    compare(placements.cbegin(), placements.cend(), single.cbegin());
+    compare(placements.id_cbegin(), placements.id_cend(), single.id_cbegin());
+
+    ids.clear();
+    for( int32_t k{0}; k < 2000; ++k ) ids.push_back((k*11)%2600 - 120);
+    for( auto id : ids ) single.erase(id);
+    placements.erase(ids.cbegin(), ids.cend());
+
+    REQUIRE( placements.size() == single.size() );
+    REQUIRE( placements.get_fingerprint() == single.get_fingerprint() );
+    REQUIRE( placements.get_area() == single.get_area() );
+    compare(placements.cbegin(), placements.cend(), single.cbegin());
+    compare(placements.id_cbegin(), placements.id_cend(), single.id_cbegin());
+  }
+
+  SECTION("Batch LookUp")
+  {
+    using Cell = std::pair<int32_t,int32_t>;
+    for( int32_t k{0}; k < 200; ++k ) placements.insert( {{k % 20, k / 20 * 3}, k} );
+
+    // Unordered, repeated and missing cells
+    std::vector<Cell> cells;
+    for( int32_t k{0}; k < 400; ++k ) cells.emplace_back((k * 37) % 23, (k * 11) % 31);
+    cells.push_back({-5,-5});
+    cells.push_back(cells.front());
+
+    std::vector<std::optional<int32_t>> ids(cells.size(), 0);
+    auto end { placements.at(cells.cbegin(), cells.cend(), ids.begin()) };
+    REQUIRE( end == ids.end() );
+    for( std::size_t k{0}; k < cells.size(); ++k ) REQUIRE( ids[k] == placements.at(cells[k]) );
+
+    // Misses are answered by the occupancy
+    placements.enable_occupancy();
+    std::vector<std::optional<int32_t>> filtered(cells.size());
+    placements.at(cells.cbegin(), cells.cend(), filtered.begin());
+    REQUIRE( filtered == ids );
+
+#ifdef __cpp_lib_span
+    // Spans too short for every cell are left as they are
+    std::vector<std::optional<int32_t>> spanned(cells.size());
+    placements.at(std::span<Cell const>(cells), std::span<std::optional<int32_t>>(spanned));
+    REQUIRE( spanned == ids );
+
+    std::vector<std::optional<int32_t>> shorter(cells.size() - 1, -1);
+    placements.at(std::span<Cell const>(cells), std::span<std::optional<int32_t>>(shorter));
+    REQUIRE( shorter == std::vector<std::optional<int32_t>>(cells.size() - 1, -1) );
+#endif
+  }
+
   SECTION("Json I/O")
   {
     placements.insert( {{8,8},9} );
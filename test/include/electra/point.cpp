@@ -0,0 +1,129 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : point
+// @created     : Sunday Oct 25, 2026 17:12:40 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <set>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+
+#include <electra/point.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+
+TEST_CASE("Packed Points", "[point]")
+{
+  using namespace electra::point;
+  using Cell = std::pair<int32_t,int32_t>;
+
+  SECTION("Packing")
+  {
+    static_assert( sizeof(Point<int16_t>) == 4 );
+    static_assert( sizeof(Point<int32_t>) == 8 );
+    static_assert( Point<int16_t>{-3,7}.x() == -3 );
+    static_assert( Point<int16_t>{-3,7}.y() == 7 );
+
+    std::vector<Cell> cells {{0,0},{-1,5},{5,-1},{-2147483647-1,2147483647},{7,7}};
+
+    for( auto const& a : cells )
+    {
+      REQUIRE( Cell(Point<int32_t>(a)) == a );
+      for( auto const& b : cells )
+      {
+        REQUIRE( (Point<int32_t>(a) < Point<int32_t>(b)) == (a < b) );
+      }
+    }
+  }
+
+  SECTION("Curves")
+  {
+    for( int32_t x{-8}; x < 8; ++x )
+    {
+      for( int32_t y{-8}; y < 8; ++y )
+      {
+        REQUIRE( from_morton<int32_t>(morton(Cell{x,y})) == Cell{x,y} );
+        REQUIRE( from_hilbert<int32_t>(hilbert(Cell{x,y})) == Cell{x,y} );
+      }
+    }
+
+    //
+    // Consecutive Hilbert codes are neighbouring cells
+    //
+    auto code { hilbert(Cell{100,-100}) };
+    for( std::uint64_t k{0}; k < 1024; ++k )
+    {
+      auto a { from_hilbert<int32_t>(code + k) };
+      auto b { from_hilbert<int32_t>(code + k + 1) };
+      REQUIRE( std::abs(a.first - b.first) + std::abs(a.second - b.second) == 1 );
+    }
+
+    Set<int32_t> set;
+    for( int32_t x{0}; x < 4; ++x ) for( int32_t y{0}; y < 4; ++y ) set.insert({x,y});
+
+    Cell last { *set.begin() };
+    for( auto it{std::next(set.begin())}; it != set.end(); ++it )
+    {
+      REQUIRE( std::abs(it->first - last.first) + std::abs(it->second - last.second) == 1 );
+      last = *it;
+    }
+  }
+
+  SECTION("Spatial Orders")
+  {
+    electra::placement::Placements<int32_t> placements;
+    for( int32_t k{0}; k < 16; ++k ) placements.insert( {{k%4, k/4}, k} );
+
+    auto ordered { placements.ordered() };
+    REQUIRE( ordered.size() == 16 );
+    for( std::size_t i{1}; i < ordered.size(); ++i )
+    {
+      REQUIRE( hilbert(ordered[i-1].first) < hilbert(ordered[i].first) );
+    }
+
+    placements.enable_occupancy();
+    REQUIRE( placements.get_occupancy()->size() == 16 );
+
+    electra::wire::Wires<int32_t> wires;
+    wires.insert( {{9,9},{9,10}} );
+    wires.insert( {{0,0},{1,0}} );
+    wires.insert( {{0,1},{0,2}} );
+
+    auto fingerprint { wires.get_fingerprint() };
+    wires.sort();
+
+    REQUIRE( wires.size() == 3 );
+    REQUIRE( wires.get_fingerprint() == fingerprint );
+    REQUIRE( wires.cbegin()->front() == Cell{0,0} );
+
+    wires.enable_occupancy();
+    REQUIRE( wires.get_occupancy()->size() == 6 );
+  }
+
+  SECTION("Stable Sort")
+  {
+    // Enough cells for a radix sort, with repeated keys
+    std::vector<std::pair<Cell,int32_t>> cells;
+    for( int32_t k{0}; k < 5000; ++k )
+    {
+      cells.push_back({{(k*7919)%211 - 105, (k*104729)%97 - 48}, k});
+    }
+    cells.push_back({{-(1 << 30), 1 << 30}, -1});
+    cells.push_back({{1 << 30, -(1 << 30)}, -2});
+
+    auto expected { cells };
+    std::stable_sort(expected.begin(), expected.end(),
+      [](auto const& a, auto const& b) { return morton(a.first) < morton(b.first); });
+
+    sort(cells.begin(), cells.end(), Morton{}, [](auto const& entry) { return entry.first; });
+
+    REQUIRE( cells == expected );
+  }
+}
@@ -0,0 +1,54 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : random
+// @created     : Wednesday Oct 21, 2026 11:40:05 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <electra/random.hpp>
+
+TEST_CASE("Random", "[random]")
+{
+  using electra::random::Generator;
+
+  SECTION("Reproducible")
+  {
+    Generator g1(42), g2(42), g3(43);
+
+    bool differs {false};
+    for( int i{0}; i < 100; ++i )
+    {
+      auto x { g1() };
+      REQUIRE( x == g2() );
+      differs |= x != g3();
+    }
+    REQUIRE( differs );
+
+    REQUIRE( electra::random::seed(1, 2, 3) == electra::random::seed(1, 2, 3) );
+    REQUIRE( electra::random::seed(1, 2, 3) != electra::random::seed(1, 3, 2) );
+  }
+
+  SECTION("Distributions")
+  {
+    Generator g(7);
+
+    for( int i{0}; i < 1000; ++i )
+    {
+      REQUIRE( g.below(10) < 10 );
+
+      auto x { g.between<int32_t>(-5, 5) };
+      REQUIRE( x >= -5 );
+      REQUIRE( x <= 5 );
+
+      auto u { g.uniform() };
+      REQUIRE( u >= 0 );
+      REQUIRE( u < 1 );
+    }
+
+    REQUIRE( g.below(0) == 0 );
+    REQUIRE( g.between<int32_t>(3, 3) == 3 );
+  }
+}
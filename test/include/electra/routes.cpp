@@ -0,0 +1,81 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : routes
+// @created     : Thursday Oct 22, 2026 10:31:08 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <electra/routes.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+
+TEST_CASE("Routes", "[routes]")
+{
+  using Cell = std::pair<int32_t,int32_t>;
+  using Path = std::vector<Cell>;
+
+  auto routes { std::make_shared<electra::routes::Cache<int32_t>>(4) };
+
+  auto encode = [](Path const& path) { return electra::wire::encode(path.cbegin(), path.cend()); };
+
+  auto r1 { encode({{0,0},{1,0},{2,0},{2,1}}) };
+  auto r2 { encode({{-9,-9},{-9,-8}}) };
+
+  SECTION("Lookup")
+  {
+    routes->insert({0,0}, {2,1}, r1, {0,0}, {10,10});
+
+    REQUIRE( routes->find({0,0},{2,1}) );
+    REQUIRE( *routes->find({0,0},{2,1}) == r1 );
+    REQUIRE_FALSE( routes->find({2,1},{0,0}) );
+    REQUIRE( routes->hits() == 2 );
+    REQUIRE( routes->misses() == 1 );
+
+    routes->erase({0,0},{2,1});
+    REQUIRE( routes->size() == 0 );
+  }
+
+  SECTION("Invalidation")
+  {
+    routes->insert({0,0}, {2,1}, r1, {0,0}, {10,10});
+    routes->insert({-9,-9}, {-9,-8}, r2);
+
+    // Outside of both regions
+    REQUIRE( routes->invalidate(Cell{11,0}, Cell{20,20}) == 0 );
+    REQUIRE( routes->invalidate(Path{{-9,-7}}) == 0 );
+    REQUIRE( routes->size() == 2 );
+
+    // Inside the region of the first route only
+    REQUIRE( routes->invalidate(Cell{-20,10}, Cell{0,12}) == 1 );
+    REQUIRE_FALSE( routes->find({0,0},{2,1}) );
+    REQUIRE( routes->find({-9,-9},{-9,-8}) );
+
+    REQUIRE( routes->invalidate(Path{{-9,-8}}) == 1 );
+    REQUIRE( routes->size() == 0 );
+  }
+
+  SECTION("Containers")
+  {
+    electra::placement::Placements<int32_t> placements;
+    electra::wire::Wires<int32_t> wires;
+
+    placements.attach_routes(routes);
+    wires.attach_routes(routes);
+
+    routes->insert({0,0}, {2,1}, r1, {0,0}, {3,3});
+    routes->insert({-9,-9}, {-9,-8}, r2);
+
+    placements.insert( {{5,5},1} );
+    wires.insert( Path{{-5,-5},{-5,-4}} );
+    REQUIRE( routes->size() == 2 );
+
+    placements.move( {{3,3},1} );
+    REQUIRE( routes->size() == 1 );
+
+    wires.insert( Path{{-10,-8},{-9,-8}} );
+    REQUIRE( routes->size() == 0 );
+  }
+}
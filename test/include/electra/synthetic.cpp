@@ -0,0 +1,145 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : synthetic
+// @created     : Monday Oct 26, 2026 15:08:37 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <set>
+#include <cstdlib>
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+#include <electra/synthetic.hpp>
+
+TEST_CASE("Synthetic Workloads", "[synthetic]")
+{
+  using namespace electra::synthetic;
+  using Cell = std::pair<int32_t,int32_t>;
+
+  Options options;
+  options.seed = 42;
+  options.width = 64;
+  options.height = 64;
+  options.placements = 1000;
+  options.wires = 200;
+
+  auto steps = [](auto const& wire)
+  {
+    for( auto it{std::next(wire.cbegin())}; it != wire.cend(); ++it )
+    {
+      auto dx { std::abs(it->first - std::prev(it)->first) };
+      auto dy { std::abs(it->second - std::prev(it)->second) };
+      REQUIRE( dx + dy == 1 );
+    }
+  };
+
+  SECTION("Reproducible")
+  {
+    for( auto kind : {Kind::UNIFORM, Kind::CLUSTERED, Kind::MESH, Kind::FLOW} )
+    {
+      auto w1 { generate<int32_t>(kind, options) };
+      auto w2 { generate<int32_t>(kind, options) };
+      REQUIRE( w1.placements == w2.placements );
+      REQUIRE( w1.wires == w2.wires );
+
+      options.seed = 43;
+      auto w3 { generate<int32_t>(kind, options) };
+      options.seed = 42;
+      REQUIRE( w1.wires != w3.wires );
+    }
+  }
+
+  SECTION("Random Kinds")
+  {
+    for( auto kind : {Kind::UNIFORM, Kind::CLUSTERED} )
+    {
+      auto workload { generate<int32_t>(kind, options) };
+
+      REQUIRE( workload.placements.size() == 1000 );
+      REQUIRE( workload.wires.size() == 200 );
+
+      std::set<Cell> cells;
+      for( auto const& [cell, id] : workload.placements )
+      {
+        REQUIRE( cell.first >= 0 );
+        REQUIRE( cell.second >= 0 );
+        REQUIRE( cell.first < 64 );
+        REQUIRE( cell.second < 64 );
+        cells.insert(cell);
+      }
+      REQUIRE( cells.size() == 1000 );
+
+      for( auto const& wire : workload.wires )
+      {
+        REQUIRE( wire.size() >= 2 );
+        steps(wire);
+      }
+    }
+
+    // The grid bounds the number of placements
+    options.placements = 64 * 64 + 10;
+    REQUIRE( generate<int32_t>(Kind::UNIFORM, options).placements.size() == 64 * 64 );
+  }
+
+  SECTION("Wire Lengths")
+  {
+    options.width = 4096;
+    options.height = 4096;
+    options.wires = 5000;
+    options.length = 20;
+
+    auto workload { generate<int32_t>(Kind::UNIFORM, options) };
+
+    std::size_t cells {0};
+    for( auto const& wire : workload.wires ) cells += wire.size();
+    auto mean { static_cast<double>(cells) / 5000 };
+    REQUIRE( mean > 18 );
+    REQUIRE( mean < 22 );
+  }
+
+  SECTION("Flow")
+  {
+    options.pitch = 6;
+    auto workload { generate<int32_t>(Kind::FLOW, options) };
+
+    REQUIRE( workload.placements.size() == 1000 );
+    REQUIRE( workload.wires.size() == 200 );
+
+    std::set<Cell> gates;
+    for( auto const& [cell, id] : workload.placements ) gates.insert(cell);
+
+    for( auto const& wire : workload.wires )
+    {
+      steps(wire);
+      for( auto it{std::next(wire.cbegin())}; it != wire.cend(); ++it )
+      {
+        // Only eastwards and southwards
+        REQUIRE( it->first >= std::prev(it)->first );
+        REQUIRE( it->second >= std::prev(it)->second );
+      }
+      for( auto const& cell : wire ) REQUIRE_FALSE( gates.count(cell) );
+    }
+  }
+
+  SECTION("Fill")
+  {
+    auto workload { generate<int32_t>(Kind::MESH, options) };
+
+    electra::placement::Placements<int32_t> placements;
+    electra::wire::Wires<int32_t> wires;
+    fill(workload, placements, wires);
+
+    REQUIRE( placements.size() == 1000 );
+    REQUIRE( wires.size() == 200 );
+    REQUIRE( placements.at({5,0}) == 1 );
+    REQUIRE( placements.find(1) == Cell{5,0} );
+
+    REQUIRE( kind("flow") == Kind::FLOW );
+    REQUIRE_FALSE( kind("spiral") );
+  }
+}
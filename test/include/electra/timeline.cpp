@@ -0,0 +1,96 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : timeline
+// @created     : Wednesday Oct 28, 2026 11:18:44 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+#include <electra/timeline.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+
+TEST_CASE("Timeline", "[timeline]")
+{
+  using namespace electra;
+  using Cell = std::pair<int32_t,int32_t>;
+  using Wire = std::vector<Cell>;
+
+  timeline::clear();
+
+  SECTION("Threads")
+  {
+    auto work = []
+    {
+      placement::Placements<int32_t> placements;
+      wire::Wires<int32_t> wires;
+
+      std::vector<std::pair<Cell,int32_t>> moves {{{0,0},1}, {{1,0},2}};
+      placements.move(moves.begin(), moves.end());
+      placements.enable_occupancy();
+      wires.insert(Wire{{0,1},{1,1}});
+      wires.sort();
+    };
+
+    std::thread t1(work), t2(work);
+    t1.join(); t2.join();
+    work();
+
+    auto j = timeline::json();
+    auto const& events { j.at("traceEvents") };
+
+    if constexpr ( timeline::enabled )
+    {
+      // Moves are a batch erase and a batch insert
+      REQUIRE( events.size() == 15 );
+
+      std::set<std::uint64_t> threads;
+      std::multiset<std::string> names;
+      for( auto const& event : events )
+      {
+        REQUIRE( event.at("ph") == "X" );
+        REQUIRE( event.at("dur").get<double>() >= 0 );
+        threads.insert(event.at("tid").get<std::uint64_t>());
+        names.insert(event.at("name").get<std::string>());
+      }
+
+      REQUIRE( threads.size() == 3 );
+      REQUIRE( names.count("placements.move") == 3 );
+      REQUIRE( names.count("placements.insert") == 3 );
+      REQUIRE( names.count("placements.enable_occupancy") == 3 );
+      REQUIRE( names.count("wires.sort") == 3 );
+
+      // Older events are dropped
+      timeline::clear();
+      REQUIRE( timeline::json().at("traceEvents").empty() );
+    }
+    else
+    {
+      REQUIRE( events.empty() );
+    }
+  }
+
+  SECTION("Overwrite")
+  {
+    if constexpr ( timeline::enabled )
+    {
+      // Only the last events of a thread are kept
+      for( std::size_t k{0}; k < timeline::CAPACITY + 10; ++k )
+      {
+        timeline::Scope scope {"overwrite"};
+      }
+      auto events = timeline::json().at("traceEvents");
+      REQUIRE( events.size() <= timeline::CAPACITY );
+      REQUIRE( events.size() >= timeline::CAPACITY - 1 );
+    }
+  }
+}
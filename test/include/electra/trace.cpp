@@ -0,0 +1,199 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : trace
+// @created     : Tuesday Oct 27, 2026 11:03:26 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <vector>
+#include <memory>
+#include <cstdio>
+#include <utility>
+#include <string>
+#include <cstdint>
+#include <fstream>
+
+#include <electra/trace.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+
+TEST_CASE("Traces", "[trace]")
+{
+  using namespace electra;
+  using Cell = std::pair<int32_t,int32_t>;
+  using Wire = std::vector<Cell>;
+
+  auto recorded { std::make_shared<trace::Trace>() };
+
+  placement::Placements<int32_t> placements;
+  wire::Wires<int32_t> wires;
+  placements.attach_trace(recorded);
+  wires.attach_trace(recorded);
+
+  // Operations of every kind
+  placements.insert(std::make_pair(Cell{3,3}, 1));
+  placements.insert(std::make_pair(Cell{9,9}, 2));
+  placements.move(std::make_pair(Cell{-4,2}, 2));
+  REQUIRE( placements.at(Cell{3,3}) == 1 );
+  REQUIRE( placements.find(2) == Cell{-4,2} );
+  wires.insert(Wire{{1,0},{2,0},{3,0},{3,1},{3,2}});
+  wires.insert(Wire{{5,5},{5,6}});
+  REQUIRE( wires.split(Cell{1,0}, Cell{3,2}, Cell{3,0}) );
+  REQUIRE( wires.join(Cell{3,0}) );
+  REQUIRE( wires.replace(Cell{1,0}, Cell{3,2}, Cell{2,0}, Cell{3,1},
+    Wire{{2,0},{2,1},{3,1}}) );
+  REQUIRE( wires.truncate(Cell{1,0}, Cell{3,2}, Cell{3,1}) );
+  REQUIRE( wires.find(Cell{5,5}, Cell{5,6}) );
+  wires.erase(Cell{5,5}, Cell{5,6});
+  placements.erase(1);
+
+  SECTION("Recording")
+  {
+    // The move is logged as an erase and an insert
+    REQUIRE( recorded->size() == 15 );
+
+    std::vector<trace::Op> ops;
+    recorded->for_each<int32_t>([&](auto const& event) { ops.push_back(event.op); });
+
+    using trace::Op;
+    REQUIRE( ops == std::vector<Op>{Op::INSERT, Op::INSERT, Op::ERASE, Op::INSERT,
+      Op::AT, Op::FIND, Op::WIRE_INSERT, Op::WIRE_INSERT, Op::SPLIT, Op::JOIN,
+      Op::REPLACE, Op::TRUNCATE, Op::WIRE_FIND, Op::WIRE_ERASE, Op::ERASE} );
+
+    // Neighbouring cells take a byte per coordinate
+    trace::Trace local;
+    Wire wire;
+    for( int32_t x{1000}; x < 1100; ++x ) wire.push_back({x, 5000});
+    local.op(Op::WIRE_INSERT).cells(wire.cbegin(), wire.cend());
+    REQUIRE( local.bytes() == 1 + 1 + (2 + 2) + 2 * 99 );
+  }
+
+  SECTION("Replay")
+  {
+    placement::Placements<int32_t> p;
+    wire::Wires<int32_t> w;
+    trace::replay(*recorded, p, w);
+
+    REQUIRE( p.get_fingerprint() == placements.get_fingerprint() );
+    REQUIRE( w.get_fingerprint() == wires.get_fingerprint() );
+    REQUIRE( p.find(2) == Cell{-4,2} );
+    REQUIRE( p.size() == 1 );
+    REQUIRE( w.size() == 1 );
+  }
+
+  SECTION("Files")
+  {
+    auto path { std::string{"electra_trace_test.bin"} };
+    recorded->write(path);
+
+    trace::Trace read;
+    read.read(path);
+    std::remove(path.c_str());
+
+    REQUIRE( read.size() == recorded->size() );
+    REQUIRE( read.bytes() == recorded->bytes() );
+    REQUIRE( read.width() == sizeof(int32_t) );
+    REQUIRE( recorded->anonymize().width() == sizeof(int32_t) );
+
+    // Appending after a read continues the deltas
+    read.op(trace::Op::AT).cell(Cell{-4,2});
+    recorded->op(trace::Op::AT).cell(Cell{-4,2});
+
+    placement::Placements<int32_t> p1, p2;
+    wire::Wires<int32_t> w1, w2;
+    auto result { trace::replay(read, p1, w1) };
+    REQUIRE( result == trace::replay(*recorded, p2, w2) );
+    REQUIRE( result != 0 );
+    REQUIRE( p1.get_fingerprint() == p2.get_fingerprint() );
+  }
+
+  SECTION("Anonymize")
+  {
+    auto anonymous { recorded->anonymize() };
+    REQUIRE( anonymous.size() == recorded->size() );
+
+    std::vector<trace::Event<int32_t>> events;
+    anonymous.for_each<int32_t>([&](auto const& event) { events.push_back(event); });
+
+    // Cells are moved to the first one, and ids given in order
+    REQUIRE( events[0].cells[0] == Cell{0,0} );
+    REQUIRE( events[0].id == 0 );
+    REQUIRE( events[1].cells[0] == Cell{6,6} );
+    REQUIRE( events[1].id == 1 );
+
+    placement::Placements<int32_t> p;
+    wire::Wires<int32_t> w;
+    trace::replay(anonymous, p, w);
+    REQUIRE( p.size() == 1 );
+    REQUIRE( w.size() == 1 );
+  }
+
+  SECTION("Malformed")
+  {
+    // A complete insert, then one whose varint is longer than 64 bits
+    trace::Trace valid;
+    valid.op(trace::Op::INSERT).cell(Cell{1,2}).id(3);
+
+    auto path { std::string{"electra_trace_malformed.bin"} };
+    valid.write(path);
+    {
+      std::ofstream os{path, std::ios::binary | std::ios::app};
+      os.put(static_cast<char>(trace::Op::INSERT));
+      for( int k{0}; k < 12; ++k ) os.put(static_cast<char>(0xFF));
+    }
+
+    trace::Trace read;
+    read.read(path);
+    std::remove(path.c_str());
+
+    // The malformed tail is dropped, appending continues after the insert
+    REQUIRE( read.size() == 1 );
+    REQUIRE( read.bytes() == valid.bytes() );
+
+    read.op(trace::Op::AT).cell(Cell{1,2});
+    valid.op(trace::Op::AT).cell(Cell{1,2});
+    placement::Placements<int32_t> p1, p2;
+    wire::Wires<int32_t> w1, w2;
+    REQUIRE( trace::replay(read, p1, w1) == trace::replay(valid, p2, w2) );
+    REQUIRE( p1.find(3) == Cell{1,2} );
+  }
+
+  SECTION("Shared Endpoints")
+  {
+    // Wires between the same endpoints, told apart by their paths
+    auto shared { std::make_shared<trace::Trace>() };
+    wire::Wires<int32_t> original;
+    original.attach_trace(shared);
+
+    std::vector<wire::Handle> handles;
+    for( int32_t k{0}; k < 4; ++k )
+    {
+      handles.push_back(original.insert(Wire{{0,0},{0,k+1},{4,k+1},{4,0}}));
+      original.insert(Wire{{0,0},{0,-k-1},{4,-k-1},{4,0}});
+    }
+    original.insert(Wire{{9,9},{9,10}});
+
+    // Neither erase removes the first wire between the endpoints
+    REQUIRE( original.erase(handles[2]) );
+    std::vector<std::pair<Cell,Cell>> endpoints {{{0,0},{4,0}}, {{9,9},{9,10}}};
+    original.erase(endpoints.cbegin(), endpoints.cend());
+    REQUIRE( original.erase(handles[3]) );
+    REQUIRE( original.size() == 5 );
+
+    wire::Wires<int32_t> replayed;
+    trace::replay(*shared, placements, replayed);
+
+    REQUIRE( replayed.get_fingerprint() == original.get_fingerprint() );
+    REQUIRE( replayed.size() == original.size() );
+
+    // Same wires, in the same order
+    auto it2 { replayed.cbegin() };
+    for( auto it1{ original.cbegin() }; it1 != original.cend(); ++it1, ++it2 )
+    {
+      REQUIRE( Wire(*it1) == Wire(*it2) );
+    }
+  }
+}
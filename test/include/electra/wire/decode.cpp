@@ -10,6 +10,9 @@
 
 #include <electra/wire/decode.hpp>
 
+inline constexpr std::array<std::pair<int32_t,int32_t>,7> decode_constant
+  {{ {0,0},{1,0},{2,0},{0,1},{2,2},{-1,0},{1,2} }};
+
 TEST_CASE("Decoding a Wire")
 {
   using Wire = std::vector<std::pair<int32_t,int32_t>>;
@@ -125,4 +128,39 @@ TEST_CASE("Decoding a Wire")
     compare(e7.cbegin(), e7.cend(), s7.cbegin());
     compare(e8.cbegin(), e8.cend(), s8.cbegin());
   }
+
+  SECTION("Caller Buffers")
+  {
+    Wire e {{0,0},{1,0},{2,0},{0,1},{2,2},{-1,0},{1,2}};
+    Wire s {{0,0},{1,0},{2,0},{2,1},{2,2},{1,2}};
+
+    REQUIRE(electra::wire::decoded_size(e.cbegin(), e.cend()) == s.size());
+
+    Wire d;
+    electra::wire::decode_into(e.cbegin(), e.cend(), std::back_inserter(d));
+    REQUIRE(d.size() == s.size());
+    compare(d.cbegin(), d.cend(), s.cbegin());
+
+    Wire buffer(s.size());
+    REQUIRE(electra::wire::decode_into(e, buffer) == s.size());
+    compare(buffer.cbegin(), buffer.cend(), s.cbegin());
+
+    Wire small(5);
+    REQUIRE_FALSE(electra::wire::decode_into(e, small));
+
+    Wire single {{4,2}};
+    REQUIRE(electra::wire::decoded_size(single.cbegin(), single.cend()) == 1);
+  }
+
+  SECTION("Compile Time")
+  {
+    constexpr auto d { electra::wire::decoded<decode_constant> };
+
+    static_assert( d.size() == 6 );
+    static_assert( d[4] == std::make_pair(2,2) );
+
+    Wire s {{0,0},{1,0},{2,0},{2,1},{2,2},{1,2}};
+
+    compare(s.cbegin(), s.cend(), d.cbegin());
+  }
 }
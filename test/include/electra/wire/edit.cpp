@@ -0,0 +1,111 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : edit
+// @created     : Monday Oct 19, 2026 09:48:02 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <electra/wire/edit.hpp>
+#include <electra/wire/encode.hpp>
+#include <electra/wire/decode.hpp>
+
+TEST_CASE("Editing an encoded wire", "[edit]")
+{
+  using Wire = std::vector<std::pair<int32_t,int32_t>>;
+
+  // Right and Downwards
+  Wire w {{0,0},{1,0},{3,0},{0,1},{3,3}};
+
+  SECTION("Locate")
+  {
+    REQUIRE( electra::wire::edit::locate(w, std::make_pair(0,0))->first == 0 );
+    REQUIRE( electra::wire::edit::locate(w, std::make_pair(3,0))->first == 0 );
+    REQUIRE( electra::wire::edit::locate(w, std::make_pair(3,1))->first == 2 );
+    REQUIRE( electra::wire::edit::locate(w, std::make_pair(3,1))->second == 1 );
+    REQUIRE_FALSE( electra::wire::edit::locate(w, std::make_pair(1,1)) );
+  }
+
+  SECTION("Split")
+  {
+    auto parts { electra::wire::edit::split(w, std::make_pair(2,0)) };
+
+    REQUIRE( parts );
+
+    Wire s1 {{0,0},{1,0},{2,0}};
+    Wire s2 {{2,0},{1,0},{3,0},{0,1},{3,3}};
+
+    REQUIRE( parts->first == s1 );
+    REQUIRE( parts->second == s2 );
+
+    parts = electra::wire::edit::split(w, std::make_pair(3,0));
+
+    Wire s3 {{0,0},{1,0},{3,0}};
+    Wire s4 {{3,0},{0,1},{3,3}};
+
+    REQUIRE( parts->first == s3 );
+    REQUIRE( parts->second == s4 );
+  }
+
+  SECTION("Join")
+  {
+    auto parts { electra::wire::edit::split(w, std::make_pair(2,0)) };
+    auto joined { electra::wire::edit::join(parts->first, parts->second) };
+
+    REQUIRE( joined );
+    REQUIRE( *joined == w );
+
+    // Turning back over the same segment is rejected
+    Wire a {{0,0},{1,0},{2,0}};
+    Wire b {{2,0},{-1,0},{1,0}};
+
+    REQUIRE_FALSE( electra::wire::edit::join(a, b) );
+  }
+
+  SECTION("Reverse")
+  {
+    auto r { electra::wire::edit::reverse(w) };
+
+    Wire s {{3,3},{0,-1},{3,0},{-1,0},{0,0}};
+
+    REQUIRE( r == s );
+
+    auto d1 { electra::wire::decode(w.cbegin(), w.cend()) };
+    auto d2 { electra::wire::decode(r.cbegin(), r.cend()) };
+
+    REQUIRE( std::equal(d1.cbegin(), d1.cend(), d2.crbegin()) );
+  }
+
+  SECTION("Truncate")
+  {
+    auto t { electra::wire::edit::truncate(w, std::make_pair(3,1)) };
+
+    Wire s {{0,0},{1,0},{3,0},{0,1},{3,1}};
+
+    REQUIRE( *t == s );
+  }
+
+  SECTION("Replace")
+  {
+    // Detour through the row below
+    Wire path {{1,0},{1,1},{2,1},{3,1}};
+    auto e { electra::wire::encode(path.cbegin(), path.cend()) };
+
+    auto r { electra::wire::edit::replace(w, std::make_pair(1,0),
+      std::make_pair(3,1), e) };
+
+    REQUIRE( r );
+
+    auto d { electra::wire::decode(r->cbegin(), r->cend()) };
+
+    Wire s {{0,0},{1,0},{1,1},{2,1},{3,1},{3,2},{3,3}};
+
+    REQUIRE( d == s );
+
+    // Cells in the wrong order
+    REQUIRE_FALSE( electra::wire::edit::replace(w, std::make_pair(3,1),
+      std::make_pair(1,0), e) );
+  }
+}
@@ -8,12 +8,16 @@
 // @description : Electra - Field-Coupled Nanocomputing Data Structures
 //
 
+#include <array>
 #include <vector>
 #include <utility>
 #include <cstdint>
 
 #include <electra/wire/encode.hpp>
 
+inline constexpr std::array<std::pair<int32_t,int32_t>,6> encode_constant
+  {{ {0,0},{1,0},{2,0},{2,1},{2,2},{1,2} }};
+
 TEST_CASE("Encoding a wire", "[encode]")
 {
   using Wire = std::vector<std::pair<int32_t,int32_t>>;
@@ -128,4 +132,40 @@ TEST_CASE("Encoding a wire", "[encode]")
     compare(e7.cbegin(), e7.cend(), s7.cbegin());
     compare(e8.cbegin(), e8.cend(), s8.cbegin());
   }
+
+  SECTION("Caller Buffers")
+  {
+    Wire w {{0,0},{1,0},{2,0},{2,1},{2,2},{1,2}};
+    Wire s {{0,0},{1,0},{2,0},{0,1},{2,2},{-1,0},{1,2}};
+
+    REQUIRE(electra::wire::encoded_size(w.cbegin(), w.cend()) == s.size());
+
+    Wire e;
+    electra::wire::encode_into(w.cbegin(), w.cend(), std::back_inserter(e));
+    REQUIRE(e.size() == s.size());
+    compare(e.cbegin(), e.cend(), s.cbegin());
+
+    std::pair<int32_t,int32_t> buffer[8];
+    REQUIRE(electra::wire::encode_into(w, buffer) == s.size());
+    compare(s.cbegin(), s.cend(), std::cbegin(buffer));
+
+    Wire small(6);
+    REQUIRE_FALSE(electra::wire::encode_into(w, small));
+
+    Wire empty;
+    REQUIRE(electra::wire::encoded_size(empty.cbegin(), empty.cend()) == 0);
+  }
+
+  SECTION("Compile Time")
+  {
+    constexpr auto e { electra::wire::encoded<encode_constant> };
+
+    static_assert( e.size() == 7 );
+    static_assert( e[3] == std::make_pair(0,1) );
+    static_assert( e[6] == std::make_pair(1,2) );
+
+    Wire s {{0,0},{1,0},{2,0},{0,1},{2,2},{-1,0},{1,2}};
+
+    compare(s.cbegin(), s.cend(), e.cbegin());
+  }
 }
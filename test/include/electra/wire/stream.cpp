@@ -0,0 +1,72 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : stream
+// @created     : Friday Oct 23, 2026 11:26:03 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+#include <electra/wire/stream.hpp>
+#include <electra/wires.hpp>
+
+#ifdef ELECTRA_COROUTINES
+
+TEST_CASE("Streaming a Wire", "[stream]")
+{
+  using Wire = std::vector<std::pair<int32_t,int32_t>>;
+
+  Wire w {{0,0},{1,0},{2,0},{3,0},{3,1},{3,2},{2,2},{1,2}};
+  auto e { electra::wire::encode(w.cbegin(), w.cend()) };
+
+  auto collect = [](auto&& generator)
+  {
+    Wire cells;
+    for( auto const& cell : generator ) cells.push_back(cell);
+    return cells;
+  };
+
+  SECTION("Whole Wire")
+  {
+    auto cells { collect(electra::wire::cells(e)) };
+    REQUIRE( cells.size() == w.size() );
+    compare(cells.cbegin(), cells.cend(), w.cbegin());
+
+    Wire single {{4,2}};
+    auto one { collect(electra::wire::cells(single)) };
+    REQUIRE( one == single );
+  }
+
+  SECTION("Region Clipping")
+  {
+    auto cells { collect(electra::wire::cells(e, {2,0}, {3,1})) };
+    Wire s {{2,0},{3,0},{3,1}};
+    REQUIRE( cells == s );
+
+    auto reverse { collect(electra::wire::cells(e, {1,2}, {2,2})) };
+    Wire r {{2,2},{1,2}};
+    REQUIRE( reverse == r );
+
+    REQUIRE( collect(electra::wire::cells(e, {10,10}, {20,20})).empty() );
+  }
+
+  SECTION("Layouts")
+  {
+    electra::wire::Wires<int32_t> wires;
+    wires.insert( w );
+    wires.insert( Wire{{-5,-5},{-5,-4},{-5,-3}} );
+
+    REQUIRE( collect(wires.cells()).size() == w.size() + 3 );
+
+    auto clipped { collect(wires.cells({-5,-4}, {0,0})) };
+    Wire s {{0,0},{-5,-4},{-5,-3}};
+    REQUIRE( clipped == s );
+  }
+}
+
+#endif
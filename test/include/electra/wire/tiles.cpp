@@ -0,0 +1,118 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : tiles
+// @created     : Saturday Oct 24, 2026 11:02:17 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <array>
+#include <tuple>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <type_traits>
+
+#include <electra/wire/tiles.hpp>
+
+TEST_CASE("Wire Tiles", "[tiles]")
+{
+  using namespace electra::wire;
+  using Wire = std::vector<std::pair<int32_t,int32_t>>;
+
+  SECTION("Precomputed Forms")
+  {
+    constexpr auto const& t { tile::west_east_bend<int32_t> };
+
+    static_assert( t.cells.size() == 9 );
+    static_assert( t.encoded.size() == encoded_size(t.cells.cbegin(), t.cells.cend()) );
+    static_assert( decoded_size(t.encoded.cbegin(), t.encoded.cend()) == t.cells.size() );
+
+    Wire cells (t.cells.cbegin(), t.cells.cend());
+    Wire list (t.encoded.cbegin(), t.encoded.cend());
+
+    auto e { encode(cells.cbegin(), cells.cend()) };
+    REQUIRE( e.size() == list.size() );
+    compare(e.cbegin(), e.cend(), list.cbegin());
+
+    auto d { decode(list.cbegin(), list.cend()) };
+    REQUIRE( d.size() == cells.size() );
+    compare(d.cbegin(), d.cend(), cells.cbegin());
+  }
+
+  SECTION("Boundaries")
+  {
+    auto inside = [](auto const& t)
+    {
+      for( auto const& cell : t.cells )
+      {
+        if( cell.first < 0 || cell.second < 0 ) return false;
+        if( cell.first >= int32_t{tile::side} || cell.second >= int32_t{tile::side} ) return false;
+      }
+      return true;
+    };
+
+    REQUIRE( inside(tile::west_east<int32_t>) );
+    REQUIRE( inside(tile::north_south<int32_t>) );
+    REQUIRE( inside(tile::west_north<int32_t>) );
+    REQUIRE( inside(tile::west_south<int32_t>) );
+    REQUIRE( inside(tile::north_east<int32_t>) );
+    REQUIRE( inside(tile::south_east<int32_t>) );
+    REQUIRE( inside(tile::west_east_bend<int32_t>) );
+  }
+
+  SECTION("Gate Footprints")
+  {
+    //
+    // Every wire stays inside the tile, enters or leaves by the
+    // center of a side, and meets the others at the center
+    //
+    auto check = [](auto const& footprint, std::size_t wires)
+    {
+      REQUIRE( std::tuple_size_v<std::decay_t<decltype(footprint)>> == wires );
+      std::apply([](auto const&... t)
+      {
+        auto valid = [](auto const& t)
+        {
+          auto side { int32_t{tile::side} };
+          auto center { std::make_pair(side/2, side/2) };
+          bool meets { false };
+          for( auto const& cell : t.cells )
+          {
+            if( cell.first < 0 || cell.second < 0 ) return false;
+            if( cell.first >= side || cell.second >= side ) return false;
+            meets = meets || cell == center;
+          }
+          auto end = [&](auto const& c)
+          {
+            return c == center || (c.first == side/2 && (c.second == 0 || c.second == side-1))
+              || (c.second == side/2 && (c.first == 0 || c.first == side-1));
+          };
+          return meets && end(t.cells.front()) && end(t.cells.back())
+            && t.encoded.size() == encoded_size(t.cells.cbegin(), t.cells.cend());
+        };
+        REQUIRE( (valid(t) && ...) );
+      }, footprint);
+    };
+
+    check(tile::fan_out<int32_t>, 3);
+    check(tile::conjunction<int32_t>, 3);
+    check(tile::majority<int32_t>, 4);
+    check(tile::crossing<int32_t>, 2);
+
+    static_assert( std::get<2>(tile::fan_out<int32_t>).cells.back() == std::make_pair(2,4) );
+  }
+
+  SECTION("Translation")
+  {
+    auto e { tile::west_north<int32_t>.encoded };
+
+    tile::translate(e.begin(), e.end(), std::make_pair(5,-5));
+
+    Wire s {{5,-3},{1,0},{7,-3},{0,-1},{7,-5}};
+
+    compare(s.cbegin(), s.cend(), e.cbegin());
+  }
+}
@@ -61,6 +61,169 @@ TEST_CASE("Wires" "[wires]")
     }
   }
 
+  SECTION("Split and Join")
+  {
+    wires.insert( {{0,0},{1,0},{2,0},{3,0},{3,1},{3,2}} );
+
+    REQUIRE( wires.split({0,0},{3,2},{3,0}) );
+    REQUIRE( wires.size() == 2 );
+    REQUIRE( wires.find({0,0},{3,0}) );
+    REQUIRE( wires.find({3,0},{3,2}) );
+    REQUIRE( wires.get_area() == std::make_pair(4,3) );
+
+    REQUIRE( wires.join({3,0}) );
+    REQUIRE( wires.size() == 1 );
+    REQUIRE( (*wires.find({0,0},{3,2}))->size() == 6 );
+
+    REQUIRE_FALSE( wires.split({0,0},{3,2},{5,5}) );
+  }
+
+  SECTION("Truncate")
+  {
+    wires.insert( {{0,0},{1,0},{2,0},{3,0},{3,1},{3,2}} );
+
+    REQUIRE( wires.truncate({0,0},{3,2},{2,0}) );
+    REQUIRE( wires.find({0,0},{2,0}) );
+    REQUIRE( wires.get_area() == std::make_pair(3,1) );
+  }
+
+  SECTION("Replace")
+  {
+    wires.insert( {{0,0},{1,0},{2,0},{3,0},{3,1},{3,2}} );
+
+    REQUIRE( wires.replace({0,0},{3,2},{1,0},{3,2},
+      {{1,0},{1,1},{1,2},{2,2},{3,2}}) );
+
+    auto search { wires.find({0,0},{3,2}) };
+
+    REQUIRE( search );
+    REQUIRE( (*search)->size() == 6 );
+
+    wires.erase({0,0},{3,2});
+
+    REQUIRE( wires.get_area() == std::make_pair(0,0) );
+  }
+
+  SECTION("Tiles")
+  {
+    auto const& tile { electra::wire::tile::west_north<int32_t> };
+
+    wires.insert( tile, {10,20} );
+
+    auto search { wires.find({10,22},{12,20}) };
+
+    REQUIRE( search );
+    REQUIRE( (*search)->size() == tile.cells.size() );
+    REQUIRE( wires.get_area() == std::make_pair(3,3) );
+
+    electra::wire::Wires<int32_t> runtime;
+    runtime.insert( {{10,22},{11,22},{12,22},{12,21},{12,20}} );
+
+    REQUIRE( wires.get_fingerprint() == runtime.get_fingerprint() );
+
+    // A footprint inserts one wire per tile
+    auto handles { wires.insert( electra::wire::tile::fan_out<int32_t>, {0,0} ) };
+
+    REQUIRE( handles.size() == 3 );
+    REQUIRE( wires.size() == 4 );
+    REQUIRE( wires.find({0,2},{2,2}) );
+    REQUIRE( wires.find({2,2},{4,2}) );
+    REQUIRE( wires.find({2,2},{2,4}) );
+    REQUIRE( wires.erase(handles[1]) );
+    REQUIRE_FALSE( wires.find({2,2},{4,2}) );
+  }
+
+  SECTION("Batch")
+  {
+    using Cell = std::pair<int32_t,int32_t>;
+    std::vector<std::vector<Cell>> list
+    {
+      {{3,1},{3,2},{3,3},{3,4}},
+      {{10,1},{9,1},{9,2},{9,3}},
+      {{3,1},{3,2},{3,3},{3,4}},
+      {{4,5},{5,5},{5,6},{5,7}},
+    };
+
+    electra::wire::Wires<int32_t> single;
+    single.enable_occupancy();
+    for( auto const& wire : list ) single.insert(wire);
+
+    wires.enable_occupancy();
+    wires.insert(list.cbegin(), list.cend());
+
+    electra::executor::Pool pool(3);
+    electra::wire::Wires<int32_t> parallel;
+    parallel.insert(list.cbegin(), list.cend(), &pool);
+
+    REQUIRE( wires.size() == 4 );
+    REQUIRE( wires.get_fingerprint() == single.get_fingerprint() );
+    REQUIRE( parallel.get_fingerprint() == single.get_fingerprint() );
+    REQUIRE( wires.get_bounds() == single.get_bounds() );
+    REQUIRE( wires.get_occupancy()->size() == single.get_occupancy()->size() );
+
+    // A repeated pair erases as many wires, missing ones are skipped
+    std::vector<std::pair<Cell,Cell>> endpoints
+      { {{3,1},{3,4}}, {{4,5},{5,7}}, {{3,1},{3,4}}, {{0,0},{1,1}} };
+    wires.erase(endpoints.cbegin(), endpoints.cend());
+    for( auto const& [a, b] : endpoints ) single.erase(a, b);
+
+    REQUIRE( wires.size() == 1 );
+    REQUIRE( wires.find({10,1},{9,3}) );
+    REQUIRE( wires.get_fingerprint() == single.get_fingerprint() );
+    REQUIRE( wires.get_area() == single.get_area() );
+    REQUIRE( wires.get_occupancy()->size() == single.get_occupancy()->size() );
+  }
+
+  SECTION("Handles")
+  {
+    using Cell = std::pair<int32_t,int32_t>;
+    using Wire = std::vector<Cell>;
+
+    // Two wires sharing their endpoints are told apart
+    auto a { wires.insert(Wire{{0,0},{1,0},{2,0},{2,1},{2,2}}) };
+    auto b { wires.insert(Wire{{0,0},{0,1},{0,2},{1,2},{2,2}}) };
+    auto c { wires.insert(Wire{{5,5},{6,5},{7,5}}) };
+    REQUIRE( a != b );
+
+    // Iterators to the other wires are kept
+    auto it { wires.find(a) };
+    REQUIRE( wires.erase(b) );
+    REQUIRE( wires.size() == 2 );
+    REQUIRE( (*it)->at(1) == Cell{1,0} );
+    REQUIRE( (*wires.find(c))->size() == 3 );
+
+    // Erased handles go stale, also once their slot is reused
+    REQUIRE_FALSE( wires.erase(b) );
+    REQUIRE_FALSE( wires.find(b) );
+    auto d { wires.insert(Wire{{9,9},{9,8}}) };
+    REQUIRE( d.index == b.index );
+    REQUIRE_FALSE( wires.find(b) );
+    REQUIRE( wires.find(d) );
+
+    // Edits, batches and sorting keep the handles
+    REQUIRE( wires.split({0,0},{2,2},{2,0}) );
+    REQUIRE( wires.find(a) );
+    REQUIRE( (*wires.find(a))->back() == Cell{2,0} );
+    REQUIRE( wires.join({2,0}) );
+    REQUIRE( (*wires.find(a))->size() == 5 );
+
+    std::vector<Wire> list { {{3,3},{3,4}}, {{4,3},{4,4}} };
+    auto handles { wires.insert(list.cbegin(), list.cend()) };
+    std::vector<std::pair<Cell,Cell>> endpoints { {{5,5},{7,5}} };
+    wires.erase(endpoints.cbegin(), endpoints.cend());
+    wires.sort();
+
+    REQUIRE_FALSE( wires.find(c) );
+    REQUIRE( (*wires.find(handles[1]))->front() == Cell{4,3} );
+    REQUIRE( (*wires.find(d))->front() == Cell{9,9} );
+    REQUIRE( (*wires.find(a))->front() == Cell{0,0} );
+    REQUIRE( wires.size() == 4 );
+
+    std::size_t count {0};
+    for( auto it{wires.cbegin()}; it != wires.cend(); ++it ) ++count;
+    REQUIRE( count == 4 );
+  }
+
   SECTION("Json Read")
   {
     wires.insert( {{3,1},{3,2},{3,3},{3,4}}   );
@@ -73,6 +236,9 @@ TEST_CASE("Wires" "[wires]")
     _wires.read("wires.json");
 
     REQUIRE( _wires.size() == 4 );
+    REQUIRE( _wires.get_fingerprint() == wires.get_fingerprint() );
+    REQUIRE( _wires.get_area() == wires.get_area() );
+    REQUIRE( *_wires.cbegin() == std::vector<std::pair<int32_t,int32_t>>{{3,1},{3,2},{3,3},{3,4}} );
 
     // Delete file wires.json
     std::remove( "wires.json" );
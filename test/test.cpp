@@ -26,6 +26,28 @@ void compare(InIt1&& cbegin, InIt1&& cend, InIt2&& target)
 
 #include "include/electra/wire/encode.cpp"
 #include "include/electra/wire/decode.cpp"
+#include "include/electra/wire/edit.cpp"
+#include "include/electra/wire/stream.cpp"
+#include "include/electra/wire/tiles.cpp"
 #include "include/electra/wires.cpp"
 #include "include/electra/area.cpp"
+#include "include/electra/density.cpp"
+#include "include/electra/occupancy.cpp"
+#include "include/electra/point.cpp"
+#include "include/electra/distance.cpp"
+#include "include/electra/legalize.cpp"
+#include "include/electra/random.cpp"
+#include "include/electra/anneal.cpp"
+#include "include/electra/fingerprint.cpp"
+#include "include/electra/cache.cpp"
+#include "include/electra/routes.cpp"
+#include "include/electra/arena.cpp"
 #include "include/electra/placements.cpp"
+#include "include/electra/hierarchy.cpp"
+#include "include/electra/layout.cpp"
+#include "include/electra/synthetic.cpp"
+#include "include/electra/trace.cpp"
+#include "include/electra/instrument.cpp"
+#include "include/electra/timeline.cpp"
+#include "include/electra/memory.cpp"
+#include "include/electra/executor.cpp"
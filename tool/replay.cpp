@@ -0,0 +1,151 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : replay
+// @created     : Tuesday Oct 27, 2026 13:40:18 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <memory_resource>
+
+#include <electra/arena.hpp>
+#include <electra/instrument.hpp>
+#include <electra/trace.hpp>
+#include <electra/placements.hpp>
+#include <electra/wires.hpp>
+
+//
+// Counts the bytes taken from the upstream resource, keeping
+// the highest count
+//
+class Peak : public std::pmr::memory_resource
+{
+  private:
+    std::pmr::memory_resource* upstream;
+    std::size_t live {0};
+    std::size_t peak {0};
+  public:
+    explicit Peak(std::pmr::memory_resource* upstream) noexcept : upstream(upstream) {}
+    std::size_t get_peak() const noexcept { return this->peak; }
+  private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+      this->live += bytes;
+      this->peak = std::max(this->peak, this->live);
+      return this->upstream->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+      this->live -= bytes;
+      this->upstream->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+    {
+      return this == &other;
+    }
+};
+
+//
+// Replays a trace on new containers of coordinates T, built
+// on the given memory resource, and reports the throughput,
+// the latency percentiles and the peak memory taken by the
+// containers
+//
+template<typename T>
+int replay(electra::trace::Trace const& recorded, std::pmr::memory_resource* upstream)
+{
+  using namespace electra;
+  using Clock = std::chrono::steady_clock;
+
+  Peak peak(upstream);
+  placement::Placements<T> placements(&peak);
+  wire::Wires<T> wires(&peak);
+
+  std::vector<std::int64_t> latencies;
+  latencies.reserve(recorded.size());
+  std::int64_t result {0};
+
+  auto beg { Clock::now() };
+  recorded.for_each<T>([&](auto const& event)
+  {
+    auto t0 { Clock::now() };
+    result += trace::apply(event, placements, wires);
+    auto t1 { Clock::now() };
+    latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+  });
+  auto seconds { std::chrono::duration<double>(Clock::now() - beg).count() };
+
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&](double p)
+  {
+    auto index { static_cast<std::size_t>(p * static_cast<double>(latencies.size() - 1)) };
+    return latencies[index];
+  };
+
+  std::cout << "operations: " << latencies.size() << '\n'
+    << "coordinates: " << sizeof(T) * 8 << " bits\n"
+    << "throughput: " << static_cast<double>(latencies.size()) / seconds << " op/s\n"
+    << "latency p50: " << percentile(0.50) << " ns\n"
+    << "latency p90: " << percentile(0.90) << " ns\n"
+    << "latency p99: " << percentile(0.99) << " ns\n"
+    << "latency p999: " << percentile(0.999) << " ns\n"
+    << "latency max: " << latencies.back() << " ns\n"
+    << "peak memory: " << peak.get_peak() << " bytes\n"
+    << "checksum: " << result << '\n';
+
+  if constexpr ( instrument::enabled )
+  {
+    nlohmann::json j {{"placements", placements.get_stats()},
+      {"wires", wires.get_stats()}, {"area", placements.get_area_stats()},
+      {"wires_area", wires.get_area_stats()}};
+    std::cout << "counters: " << j << '\n';
+  }
+
+  return EXIT_SUCCESS;
+}
+
+//
+// Picks the type of the coordinates from the width recorded
+// in the trace, traces without cells take 32 bits
+//
+int main(int argc, char** argv)
+{
+  using namespace electra;
+
+  auto usage = [&]
+  {
+    std::cerr << "usage: " << argv[0] << " <trace> [--resource default|pool|arena]\n";
+    return EXIT_FAILURE;
+  };
+
+  if( argc != 2 && argc != 4 ) return usage();
+
+  std::string resource_name { argc == 4 ? argv[3] : "default" };
+  if( argc == 4 && std::string{argv[2]} != "--resource" ) return usage();
+
+  trace::Trace recorded;
+  recorded.read(std::string{argv[1]});
+  if( recorded.size() == 0 ) { std::cerr << "empty or invalid trace\n"; return EXIT_FAILURE; }
+
+  std::pmr::unsynchronized_pool_resource pool;
+  arena::Arena arena;
+  std::pmr::memory_resource* upstream { std::pmr::get_default_resource() };
+  if( resource_name == "pool" ) upstream = &pool;
+  else if( resource_name == "arena" ) upstream = &arena;
+  else if( resource_name != "default" ) return usage();
+
+  if( recorded.width() <= sizeof(std::int32_t) ) return replay<std::int32_t>(recorded, upstream);
+  if( recorded.width() == sizeof(std::int64_t) ) return replay<std::int64_t>(recorded, upstream);
+
+  std::cerr << "unsupported coordinate width: " << recorded.width() << " bytes\n";
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,122 @@
+// vim: set ts=2 sw=2 tw=0 et :
+//
+// @company     : Universidade Federal de Viçosa - Florestal
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : synthetic
+// @created     : Monday Oct 26, 2026 16:02:19 -03
+// @license     : MIT
+// @description : Electra - Field-Coupled Nanocomputing Data Structures
+//
+
+#include <chrono>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <iostream>
+#include <stdexcept>
+
+#include <electra/synthetic.hpp>
+
+//
+// Generates a synthetic workload, filling the containers and,
+// with --out, writing them as json:
+//   <out>pid.json, <out>idp.json, <out>area.json and <out>wires.json
+// and, with --trace, recording the insertions as a trace for
+// the replay tool
+//
+int main(int argc, char** argv)
+{
+  using namespace electra;
+  using Clock = std::chrono::steady_clock;
+
+  auto usage = [&]
+  {
+    std::cerr << "usage: " << argv[0]
+      << " [--kind uniform|clustered|mesh|flow] [--placements n] [--wires n]"
+         " [--seed n] [--width n] [--height n] [--length x] [--bend x]"
+         " [--clusters n] [--spread x] [--pitch n] [--out prefix]"
+         " [--trace path]\n";
+    return EXIT_FAILURE;
+  };
+
+  synthetic::Kind kind { synthetic::Kind::UNIFORM };
+  synthetic::Options options;
+  std::string out;
+  std::string path;
+
+  for( int i{1}; i < argc; ++i )
+  {
+    std::string arg { argv[i] };
+    if( i + 1 == argc ) return usage();
+    std::string value { argv[++i] };
+
+    // Numbers that do not parse or do not fit are a usage error
+    try
+    {
+      if( arg == "--kind" )
+      {
+        auto k { synthetic::kind(value) };
+        if( ! k ) return usage();
+        kind = *k;
+      }
+      else if( arg == "--placements" ) options.placements = std::stoull(value);
+      else if( arg == "--wires" ) options.wires = std::stoull(value);
+      else if( arg == "--seed" ) options.seed = std::stoull(value);
+      else if( arg == "--width" ) options.width = std::stoull(value);
+      else if( arg == "--height" ) options.height = std::stoull(value);
+      else if( arg == "--length" ) options.length = std::stod(value);
+      else if( arg == "--bend" ) options.bend = std::stod(value);
+      else if( arg == "--clusters" ) options.clusters = std::stoull(value);
+      else if( arg == "--spread" ) options.spread = std::stod(value);
+      else if( arg == "--pitch" ) options.pitch = std::stoull(value);
+      else if( arg == "--out" ) out = value;
+      else if( arg == "--trace" ) path = value;
+      else return usage();
+    }
+    catch( std::logic_error const& )
+    {
+      return usage();
+    }
+  }
+
+  auto seconds = [](auto beg)
+  {
+    return std::chrono::duration<double>(Clock::now() - beg).count();
+  };
+
+  auto beg { Clock::now() };
+  auto workload { synthetic::generate<int32_t>(kind, options) };
+
+  std::size_t cells { workload.placements.size() };
+  for( auto const& wire : workload.wires ) cells += wire.size();
+  std::cerr << "generate: " << cells << " cells in " << seconds(beg) << "s\n";
+
+  beg = Clock::now();
+  placement::Placements<int32_t> placements;
+  wire::Wires<int32_t> wires;
+  auto recorded { std::make_shared<trace::Trace>() };
+  if( ! path.empty() )
+  {
+    placements.attach_trace(recorded);
+    wires.attach_trace(recorded);
+  }
+  synthetic::fill(workload, placements, wires);
+  std::cerr << "fill: " << seconds(beg) << "s\n";
+
+  if( ! path.empty() )
+  {
+    recorded->write(path);
+    std::cerr << "trace: " << recorded->size() << " operations, "
+      << recorded->bytes() << " bytes\n";
+  }
+
+  if( out.empty() ) return EXIT_SUCCESS;
+
+  beg = Clock::now();
+  placements.write(out);
+  wires.write(out + "wires.json");
+  std::cerr << "write: " << seconds(beg) << "s\n";
+
+  return EXIT_SUCCESS;
+}